@@ -0,0 +1,70 @@
+/* Helpers shared by the benchmark programs */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+#include <sched.h>
+#include <unistd.h>
+
+#ifndef BENCH_H
+#define BENCH_H
+
+// Wall clock time in seconds
+static inline double benchNow(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Getting a numeric command line argument, or a default value if it is not given
+static inline size_t benchArg(int argc, char** argv, int index, size_t default_value)
+{
+    return index < argc ? (size_t)strtoull(argv[index], NULL, 10) : default_value;
+}
+
+// The number of online cores, the default upper bound of thread sweeps
+static inline size_t benchCores(void)
+{
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return cores > 0 ? (size_t)cores : 1;
+}
+
+// Pseudo-random generator with a state per thread, xorshift64*
+static inline uint64_t benchRandom(uint64_t* state)
+{
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 0x2545F4914F6CDD1DULL;
+}
+
+// Starting all threads of a run at once, so that thread creation is not measured
+typedef struct BenchGate_type {
+    atomic_size_t ready;
+    atomic_bool open;
+} BenchGate;
+
+static inline void benchGateWait(BenchGate* gate)
+{
+    atomic_fetch_add(&gate->ready, 1);
+    while (!atomic_load(&gate->open)) {
+        sched_yield();
+    }
+}
+
+static inline double benchGateOpen(BenchGate* gate, size_t threads)
+{
+    while (atomic_load(&gate->ready) < threads) {
+        sched_yield();
+    }
+    atomic_store(&gate->open, true);
+    return benchNow();
+}
+
+
+#endif // BENCH_H
@@ -0,0 +1,134 @@
+/*
+
+Comparison benchmark of B+ Tree against Binary Search Tree.
+
+ Both trees get the same distinct keys in random order and then answer
+ the same random lookups and range scans. A range scan seeks to a random
+ key and walks a given number of keys in sorted order. Building from a
+ sorted Array is measured as well. Raw values are compared in both trees,
+ so the difference comes only from the layout of nodes.
+
+ Usage:
+    bplustree_bench [keys] [lookups] [scans] [scan length]
+
+*/
+
+#include "bench.h"
+#include "../include/bplustree.h"
+#include "../include/binsearchtree.h"
+
+// Keys are odd numbers, so that every key is distinct and not zero
+static void** _benchKeys__(size_t count, uint64_t* seed)
+{
+    void** keys = (void**)malloc(count * sizeof(void*));
+    for (size_t i = 0; i < count; i++) {
+        keys[i] = (void*)(uintptr_t)(2 * i + 1);
+    }
+    for (size_t i = count - 1; i > 0; i--) {
+        size_t j = benchRandom(seed) % (i + 1);
+        void* temp = keys[i];
+        keys[i] = keys[j];
+        keys[j] = temp;
+    }
+    return keys;
+}
+
+static void _benchRow__(const char* name, size_t count, double bpt, double bst)
+{
+    printf("%-22s %14.2f %14.2f %10.2fx\n", name, count / bpt * 1e-6, count / bst * 1e-6, bst / bpt);
+}
+
+int main(int argc, char** argv)
+{
+    size_t count = benchArg(argc, argv, 1, (size_t)1 << 22);
+    size_t lookups = benchArg(argc, argv, 2, (size_t)1 << 22);
+    size_t scans = benchArg(argc, argv, 3, (size_t)1 << 16);
+    size_t scan_length = benchArg(argc, argv, 4, 100);
+
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    void** keys = _benchKeys__(count, &seed);
+    void** probes = (void**)malloc(lookups * sizeof(void*));
+    for (size_t i = 0; i < lookups; i++) {
+        probes[i] = keys[benchRandom(&seed) % count];
+    }
+    size_t found = 0;
+    double start, bpt, bst;
+
+    printf("keys %zu, lookups %zu, scans %zu x %zu\n", count, lookups, scans, scan_length);
+    printf("%-22s %14s %14s %11s\n", "", "bptree M/s", "bstree M/s", "speedup");
+
+    BPTree* bptree = bptreeNew(NULL);
+    BSTree* bstree = bstreeNew(NULL);
+    start = benchNow();
+    for (size_t i = 0; i < count; i++) {
+        bptreeInsert(bptree, keys[i], keys[i]);
+    }
+    bpt = benchNow() - start;
+    start = benchNow();
+    for (size_t i = 0; i < count; i++) {
+        bstreeAppend(bstree, keys[i]);
+    }
+    bst = benchNow() - start;
+    _benchRow__("random inserts", count, bpt, bst);
+
+    void* value;
+    start = benchNow();
+    for (size_t i = 0; i < lookups; i++) {
+        found += bptreeFind(bptree, probes[i], &value);
+    }
+    bpt = benchNow() - start;
+    start = benchNow();
+    for (size_t i = 0; i < lookups; i++) {
+        found += bstreeSearch(bstree, probes[i]);
+    }
+    bst = benchNow() - start;
+    _benchRow__("random lookups", lookups, bpt, bst);
+
+    // The upper bound of a range is unknown to the B+ tree iterator, it just takes [scan_length] keys
+    start = benchNow();
+    BPTreeIterator* bpt_iter = bptreeIterNew(bptree);
+    for (size_t i = 0; i < scans; i++) {
+        bptreeIterSeek(bpt_iter, probes[i % lookups]);
+        for (size_t j = 0; j < scan_length && bptreeIterHasNext(bpt_iter); j++) {
+            found += (uintptr_t)bptreeIterNext(bpt_iter, &value) & 1;
+        }
+    }
+    bptreeIterDelete(bpt_iter);
+    bpt = benchNow() - start;
+    start = benchNow();
+    for (size_t i = 0; i < scans; i++) {
+        void* low = probes[i % lookups];
+        BSTreeIterator* bst_iter = bstreeRangeIterNew(bstree, low, (void*)((uintptr_t)low + 2 * scan_length - 2));
+        while (bstreeIterHasNext(bst_iter)) {
+            found += (uintptr_t)bstreeIterNext(bst_iter) & 1;
+        }
+        bstreeIterDelete(bst_iter);
+    }
+    bst = benchNow() - start;
+    _benchRow__("range scans (keys)", scans * scan_length, bpt, bst);
+
+    bptreeDelete(bptree);
+    bstreeFree(bstree);
+
+    Array* sorted = arrayNew();
+    for (size_t i = 0; i < count; i++) {
+        arrayToEnd(sorted, (void*)(uintptr_t)(2 * i + 1));
+    }
+    start = benchNow();
+    bptree = bptreeFromSortedArray(sorted, NULL, NULL);
+    bpt = benchNow() - start;
+    start = benchNow();
+    bstree = bstreeFromSortedArray(sorted, NULL);
+    bst = benchNow() - start;
+    _benchRow__("bulk load", count, bpt, bst);
+
+    bptreeDelete(bptree);
+    bstreeFree(bstree);
+    arrayFree(sorted);
+    free(probes);
+    free(keys);
+
+    // Printed, so that the compiler can't drop the searches
+    printf("checksum %zu\n", found);
+    return 0;
+}
@@ -0,0 +1,152 @@
+/*
+
+Scaling benchmark of Concurrent Hash Table.
+
+ Every thread makes the same number of random operations over a fixed set
+ of keys, half of which is in the table at the beginning. A read is a
+ lookup, a write is an insertion or an erasure with equal chances. Two
+ mixes are measured, read-heavy (95% reads) and write-heavy (50% reads),
+ the number of threads grows by doubling up to a given limit. As a
+ baseline the same operations go to a Hash Table guarded by one mutex.
+
+ Usage:
+    chashtable_bench [max threads] [operations] [keys]
+
+*/
+
+#include "bench.h"
+#include "../include/chashtable.h"
+
+typedef struct CHTBench_type {
+    BenchGate gate;
+    size_t per_thread;
+    size_t keys;
+    size_t read_percent;
+    ConcurrentHashTable* cht;
+    HashTable* ht;
+    pthread_mutex_t lock;
+} CHTBench;
+
+typedef struct CHTWorker_type {
+    CHTBench* bench;
+    uint64_t seed;
+} CHTWorker;
+
+static size_t _benchHash__(const void* key)
+{
+    uint64_t x = (uint64_t)(uintptr_t)key;
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDULL;
+    x ^= x >> 33;
+    return (size_t)x;
+}
+
+static bool _benchEqual__(const void* a, const void* b)
+{
+    return a == b;
+}
+
+static void* _chtWorker__(void* arg)
+{
+    CHTWorker* worker = (CHTWorker*)arg;
+    CHTBench* bench = worker->bench;
+    benchGateWait(&bench->gate);
+
+    void* value;
+    for (size_t i = 0; i < bench->per_thread; i++) {
+        uint64_t r = benchRandom(&worker->seed);
+        void* key = (void*)(uintptr_t)(1 + (r >> 8) % bench->keys);
+        if (r % 100 < bench->read_percent) {
+            chtFind(bench->cht, key, &value);
+        } else if (r & 128) {
+            chtInsert(bench->cht, key, key);
+        } else {
+            chtErase(bench->cht, key);
+        }
+    }
+    return NULL;
+}
+
+static void* _mutexWorker__(void* arg)
+{
+    CHTWorker* worker = (CHTWorker*)arg;
+    CHTBench* bench = worker->bench;
+    benchGateWait(&bench->gate);
+
+    void* value;
+    for (size_t i = 0; i < bench->per_thread; i++) {
+        uint64_t r = benchRandom(&worker->seed);
+        void* key = (void*)(uintptr_t)(1 + (r >> 8) % bench->keys);
+        pthread_mutex_lock(&bench->lock);
+        if (r % 100 < bench->read_percent) {
+            htFind(bench->ht, key, &value);
+        } else if (r & 128) {
+            htInsert(bench->ht, key, key);
+        } else {
+            htErase(bench->ht, key);
+        }
+        pthread_mutex_unlock(&bench->lock);
+    }
+    return NULL;
+}
+
+// Running [threads] workers, returns millions of operations per second
+static double _benchRun__(CHTBench* bench, size_t threads, size_t operations, void* (*routine)(void*))
+{
+    pthread_t* ids = (pthread_t*)malloc(threads * sizeof(pthread_t));
+    CHTWorker* workers = (CHTWorker*)malloc(threads * sizeof(CHTWorker));
+    atomic_store(&bench->gate.ready, 0);
+    atomic_store(&bench->gate.open, false);
+    bench->per_thread = operations / threads;
+
+    for (size_t i = 0; i < threads; i++) {
+        workers[i].bench = bench;
+        workers[i].seed = 0x9E3779B97F4A7C15ULL * (i + 1);
+        pthread_create(&ids[i], NULL, routine, &workers[i]);
+    }
+    double start = benchGateOpen(&bench->gate, threads);
+    for (size_t i = 0; i < threads; i++) {
+        pthread_join(ids[i], NULL);
+    }
+    double elapsed = benchNow() - start;
+
+    free(workers);
+    free(ids);
+    return bench->per_thread * threads / elapsed * 1e-6;
+}
+
+int main(int argc, char** argv)
+{
+    size_t max_threads = benchArg(argc, argv, 1, benchCores());
+    size_t operations = benchArg(argc, argv, 2, (size_t)1 << 22);
+    size_t keys = benchArg(argc, argv, 3, (size_t)1 << 20);
+    size_t mixes[] = { 95, 50 };
+
+    CHTBench bench;
+    bench.keys = keys;
+    pthread_mutex_init(&bench.lock, NULL);
+
+    printf("operations %zu, keys %zu, cores %zu\n", operations, keys, benchCores());
+    for (size_t m = 0; m < sizeof(mixes) / sizeof(mixes[0]); m++) {
+        bench.read_percent = mixes[m];
+        printf("%zu%% reads\n%10s %18s %18s\n", mixes[m], "threads", "cht Mops/s", "mutex Mops/s");
+        for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+            bench.cht = chtNew(_benchHash__, _benchEqual__);
+            bench.ht = htNew(_benchHash__, _benchEqual__);
+            for (size_t k = 1; k <= keys; k += 2) {
+                chtInsert(bench.cht, (void*)k, (void*)k);
+                htInsert(bench.ht, (void*)k, (void*)k);
+            }
+
+            double cht = _benchRun__(&bench, threads, operations, _chtWorker__);
+            double mutex = _benchRun__(&bench, threads, operations, _mutexWorker__);
+            printf("%10zu %18.2f %18.2f\n", threads, cht, mutex);
+
+            chtDelete(bench.cht);
+            htDelete(bench.ht);
+        }
+    }
+
+    pthread_mutex_destroy(&bench.lock);
+    return 0;
+}
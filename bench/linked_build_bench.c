@@ -0,0 +1,104 @@
+/*
+
+Build time benchmark of the linked containers.
+
+ List, DList, Stack and Queue are built by appending N elements at their
+ growing end, N doubles up to a given limit, and the limit itself is the
+ last size. Ends are O(1), so the time per element should stay flat as N
+ grows, i.e. the build time should be linear. Deleting of the built
+ container is reported separately.
+
+ Usage:
+    linked_build_bench [max elements]
+
+*/
+
+#include "bench.h"
+
+/* The headers of these containers define different types with the same
+ * name Node, so they can't be included together; only the calls needed
+ * here are declared, with the containers as incomplete types.
+ */
+typedef struct SLL_type List;
+typedef struct DLL_type DList;
+typedef struct Stack_type Stack;
+typedef struct Queue_type Queue;
+
+List* listNew();
+void listPush(List* list, void* value);
+void listDelete(List* list);
+
+DList* dlistNew();
+void dlistPush(DList* list, void* value);
+void dlistDelete(DList* list);
+
+Stack* stackNew();
+void stackPush(Stack* stack, void* value);
+void stackDelete(Stack* stack);
+
+Queue* queueNew();
+void enqueue(Queue* queue, void* item);
+void queueDelete(Queue* queue);
+
+// One container under test, the delete calls don't free the container structure itself
+typedef struct LinkedBench_type {
+    const char* name;
+    void* (*create)(void);
+    void (*push)(void* container, void* value);
+    void (*destroy)(void* container);
+} LinkedBench;
+
+static void* _listCreate__(void) { return listNew(); }
+static void _listPush__(void* c, void* v) { listPush((List*)c, v); }
+static void _listDestroy__(void* c) { listDelete((List*)c); }
+
+static void* _dlistCreate__(void) { return dlistNew(); }
+static void _dlistPush__(void* c, void* v) { dlistPush((DList*)c, v); }
+static void _dlistDestroy__(void* c) { dlistDelete((DList*)c); }
+
+static void* _stackCreate__(void) { return stackNew(); }
+static void _stackPush__(void* c, void* v) { stackPush((Stack*)c, v); }
+static void _stackDestroy__(void* c) { stackDelete((Stack*)c); }
+
+static void* _queueCreate__(void) { return queueNew(); }
+static void _queuePush__(void* c, void* v) { enqueue((Queue*)c, v); }
+static void _queueDestroy__(void* c) { queueDelete((Queue*)c); }
+
+int main(int argc, char** argv)
+{
+    size_t max_size = benchArg(argc, argv, 1, 10000000);
+    LinkedBench benches[] = {
+        { "List", _listCreate__, _listPush__, _listDestroy__ },
+        { "DList", _dlistCreate__, _dlistPush__, _dlistDestroy__ },
+        { "Stack", _stackCreate__, _stackPush__, _stackDestroy__ },
+        { "Queue", _queueCreate__, _queuePush__, _queueDestroy__ },
+    };
+    size_t count = sizeof(benches) / sizeof(benches[0]);
+
+    printf("nanoseconds per element, build / delete\n%10s", "elements");
+    for (size_t b = 0; b < count; b++) {
+        printf(" %17s", benches[b].name);
+    }
+    printf("\n");
+
+    for (size_t size = 1024;; size = size * 2 < max_size ? size * 2 : max_size) {
+        printf("%10zu", size);
+        for (size_t b = 0; b < count; b++) {
+            void* container = benches[b].create();
+            double start = benchNow();
+            for (size_t i = 0; i < size; i++) {
+                benches[b].push(container, (void*)i);
+            }
+            double built = benchNow();
+            benches[b].destroy(container);
+            double deleted = benchNow();
+            free(container);
+            printf(" %8.2f / %6.2f", (built - start) / size * 1e9, (deleted - built) / size * 1e9);
+        }
+        printf("\n");
+        if (size == max_size) {
+            break;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,120 @@
+/*
+
+Contention benchmark of MPMC queue.
+
+ The same number of producers and consumers move a fixed number of items
+ through the queue, the number of threads on each side grows by doubling
+ up to a given limit. As a baseline the items go through a Dynamic Array
+ queue guarded by one global mutex.
+
+ Usage:
+    mpmcqueue_bench [max threads per side] [items] [capacity]
+
+*/
+
+#include "bench.h"
+#include "../include/mpmcqueue.h"
+#include "../include/daqueue.h"
+
+typedef struct MPMCBench_type {
+    BenchGate gate;
+    size_t per_thread;
+    MPMCQueue* mpmc;
+    Queue* queue;
+    pthread_mutex_t lock;
+} MPMCBench;
+
+static void* _mpmcProducer__(void* arg)
+{
+    MPMCBench* bench = (MPMCBench*)arg;
+    benchGateWait(&bench->gate);
+    for (size_t i = 1; i <= bench->per_thread; i++) {
+        mpmcQueuePush(bench->mpmc, (void*)i);
+    }
+    return NULL;
+}
+
+static void* _mpmcConsumer__(void* arg)
+{
+    MPMCBench* bench = (MPMCBench*)arg;
+    benchGateWait(&bench->gate);
+    for (size_t i = 0; i < bench->per_thread; i++) {
+        mpmcQueuePop(bench->mpmc);
+    }
+    return NULL;
+}
+
+static void* _mutexProducer__(void* arg)
+{
+    MPMCBench* bench = (MPMCBench*)arg;
+    benchGateWait(&bench->gate);
+    for (size_t i = 1; i <= bench->per_thread; i++) {
+        pthread_mutex_lock(&bench->lock);
+        daEnqueue(bench->queue, (void*)i);
+        pthread_mutex_unlock(&bench->lock);
+    }
+    return NULL;
+}
+
+static void* _mutexConsumer__(void* arg)
+{
+    MPMCBench* bench = (MPMCBench*)arg;
+    benchGateWait(&bench->gate);
+    for (size_t i = 0; i < bench->per_thread;) {
+        pthread_mutex_lock(&bench->lock);
+        if (!daQueueIsEmpty(bench->queue)) {
+            daDequeue(bench->queue);
+            i++;
+        }
+        pthread_mutex_unlock(&bench->lock);
+    }
+    return NULL;
+}
+
+// Running [threads] producers and [threads] consumers, returns millions of items per second
+static double _benchRun__(MPMCBench* bench, size_t threads, size_t items,
+    void* (*producer)(void*), void* (*consumer)(void*))
+{
+    pthread_t* ids = (pthread_t*)malloc(2 * threads * sizeof(pthread_t));
+    atomic_store(&bench->gate.ready, 0);
+    atomic_store(&bench->gate.open, false);
+    bench->per_thread = items / threads;
+
+    for (size_t i = 0; i < threads; i++) {
+        pthread_create(&ids[2 * i], NULL, producer, bench);
+        pthread_create(&ids[2 * i + 1], NULL, consumer, bench);
+    }
+    double start = benchGateOpen(&bench->gate, 2 * threads);
+    for (size_t i = 0; i < 2 * threads; i++) {
+        pthread_join(ids[i], NULL);
+    }
+    double elapsed = benchNow() - start;
+
+    free(ids);
+    return bench->per_thread * threads / elapsed * 1e-6;
+}
+
+int main(int argc, char** argv)
+{
+    size_t max_threads = benchArg(argc, argv, 1, benchCores());
+    size_t items = benchArg(argc, argv, 2, (size_t)1 << 22);
+    size_t capacity = benchArg(argc, argv, 3, 1024);
+
+    MPMCBench bench;
+    bench.mpmc = mpmcQueueNew(capacity);
+    bench.queue = daQueueNew();
+    pthread_mutex_init(&bench.lock, NULL);
+
+    printf("items %zu, capacity %zu, cores %zu\n", items, capacity, benchCores());
+    printf("%10s %18s %18s\n", "threads", "mpmc Mitems/s", "mutex Mitems/s");
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        double mpmc = _benchRun__(&bench, threads, items, _mpmcProducer__, _mpmcConsumer__);
+        double mutex = _benchRun__(&bench, threads, items, _mutexProducer__, _mutexConsumer__);
+        printf("%7zu+%-2zu %18.2f %18.2f\n", threads, threads, mpmc, mutex);
+    }
+
+    pthread_mutex_destroy(&bench.lock);
+    mpmcQueueDelete(bench.mpmc);
+    daQueueDelete(bench.queue);
+    return 0;
+}
@@ -0,0 +1,73 @@
+/*
+
+Scaling benchmark of parallel sample sort.
+
+ The same array of random integers is sorted by introsort on one thread,
+ and then by the parallel sort with the number of threads growing by
+ doubling up to a given limit. Every result is checked to be sorted. The
+ speedup is taken against introsort, which the parallel sort falls back
+ to for small arrays.
+
+ Usage:
+    parallelsort_bench [max threads] [elements] [comparator]
+
+ If [comparator] is 1, elements are compared by a function, otherwise raw
+ values are compared; the first one is closer to sorting of real records.
+
+*/
+
+#include "bench.h"
+#include <string.h>
+#include "../include/array_sortings.h"
+
+static int _benchCompare__(const void* a, const void* b, void* ctx)
+{
+    (void)ctx;
+    return ((uintptr_t)a > (uintptr_t)b) - ((uintptr_t)a < (uintptr_t)b);
+}
+
+static bool _benchIsSorted__(void** array, size_t size)
+{
+    for (size_t i = 1; i < size; i++) {
+        if ((uintptr_t)array[i - 1] > (uintptr_t)array[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    size_t max_threads = benchArg(argc, argv, 1, 64);
+    size_t size = benchArg(argc, argv, 2, (size_t)1 << 24);
+    ArrayCompare cmp = benchArg(argc, argv, 3, 0) ? _benchCompare__ : NULL;
+
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    void** source = (void**)malloc(size * sizeof(void*));
+    void** array = (void**)malloc(size * sizeof(void*));
+    for (size_t i = 0; i < size; i++) {
+        source[i] = (void*)(uintptr_t)benchRandom(&seed);
+    }
+
+    printf("elements %zu, %s, cores %zu\n", size, cmp ? "comparator" : "raw values", benchCores());
+    printf("%10s %12s %12s\n", "threads", "seconds", "speedup");
+
+    memcpy(array, source, size * sizeof(void*));
+    double start = benchNow();
+    introSort(array, size, cmp, NULL);
+    double serial = benchNow() - start;
+    printf("%10s %12.3f %12.2f%s\n", "introsort", serial, 1.0, _benchIsSorted__(array, size) ? "" : " NOT SORTED");
+
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        memcpy(array, source, size * sizeof(void*));
+        start = benchNow();
+        parallelSort(array, size, cmp, NULL, threads);
+        double elapsed = benchNow() - start;
+        printf("%10zu %12.3f %12.2f%s\n", threads, elapsed, serial / elapsed,
+            _benchIsSorted__(array, size) ? "" : " NOT SORTED");
+    }
+
+    free(array);
+    free(source);
+    return 0;
+}
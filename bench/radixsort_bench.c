@@ -0,0 +1,77 @@
+/*
+
+Benchmark of radix sort against introsort.
+
+ The same random integers are sorted by radix sort and by introsort, both
+ comparing raw values, the number of elements grows by multiplying by 10
+ up to a given limit. Every result is checked to be sorted. Keys of a
+ small range are measured as well, radix sort skips the passes over the
+ digits, which are the same for all keys.
+
+ Usage:
+    radixsort_bench [max elements]
+
+*/
+
+#include "bench.h"
+#include <string.h>
+#include "../include/array_sortings.h"
+
+static bool _benchIsSorted__(void** array, size_t size)
+{
+    for (size_t i = 1; i < size; i++) {
+        if ((uintptr_t)array[i - 1] > (uintptr_t)array[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Sorting a copy of [source] by both sorts, returns the speedup of radix sort
+static double _benchRun__(void** source, void** array, size_t size, double* radix, double* intro)
+{
+    memcpy(array, source, size * sizeof(void*));
+    double start = benchNow();
+    radixSort(array, size, NULL, NULL);
+    *radix = benchNow() - start;
+    if (!_benchIsSorted__(array, size)) {
+        printf("radix sort result is NOT SORTED\n");
+    }
+
+    memcpy(array, source, size * sizeof(void*));
+    start = benchNow();
+    introSort(array, size, NULL, NULL);
+    *intro = benchNow() - start;
+    if (!_benchIsSorted__(array, size)) {
+        printf("introsort result is NOT SORTED\n");
+    }
+    return *intro / *radix;
+}
+
+int main(int argc, char** argv)
+{
+    size_t max_size = benchArg(argc, argv, 1, 10000000);
+    void** source = (void**)malloc(max_size * sizeof(void*));
+    void** array = (void**)malloc(max_size * sizeof(void*));
+    uint64_t ranges[] = { 0, (uint64_t)1 << 20 };
+
+    for (size_t r = 0; r < sizeof(ranges) / sizeof(ranges[0]); r++) {
+        uint64_t seed = 0x9E3779B97F4A7C15ULL;
+        for (size_t i = 0; i < max_size; i++) {
+            uint64_t key = benchRandom(&seed);
+            source[i] = (void*)(uintptr_t)(ranges[r] ? key % ranges[r] : key);
+        }
+
+        printf("%s keys\n", ranges[r] ? "20-bit" : "64-bit");
+        printf("%10s %14s %14s %10s\n", "elements", "radix ms", "introsort ms", "speedup");
+        for (size_t size = 10; size <= max_size; size *= 10) {
+            double radix, intro;
+            double speedup = _benchRun__(source, array, size, &radix, &intro);
+            printf("%10zu %14.3f %14.3f %9.2fx\n", size, radix * 1e3, intro * 1e3, speedup);
+        }
+    }
+
+    free(array);
+    free(source);
+    return 0;
+}
@@ -27,6 +27,15 @@ typedef struct Array_type {
     void **buff;
 } Array;
 
+// Comparator of two elements, less than 0 means that [a] stands before [b]
+typedef int (*ArrayCompare)(const void* a, const void* b, void* ctx);
+
+// Sorting function, see "include/array_sortings.h"
+typedef void (*ArraySortFunc)(void** buff, size_t size, ArrayCompare cmp, void* ctx);
+
+// Extractor of an unsigned integer key of an element for radix sort
+typedef uint64_t (*ArrayRadixKey)(const void* value, void* ctx);
+
 // Configuration structure for customization
 typedef struct Config_type {
     // Almost the same stuff, but now for the customization
@@ -131,11 +140,17 @@ void arrayExtend(Array* f_arr, Array* s_arr);
 // Swapping two arrays
 void swapArrays(Array* f_arr, Array* s_arr);
 
-// Sorting a given array 'in-place' by a chosen sort function
-void arraySortMut(Array* array, void**(*func)(void**, int));
+// Sorting a given array 'in-place' by a chosen sort function, introsort if it is NULL
+void arraySortMut(Array* array, ArraySortFunc func, ArrayCompare cmp, void* ctx);
 
 // Creating a copy, sorting it by a chosen sort function and return
-Array* arraySortNew(Array* array, void**(*func)(void**, int));
+Array* arraySortNew(Array* array, ArraySortFunc func, ArrayCompare cmp, void* ctx);
+
+// Sorting an array in-place by integer keys of elements, stable, NULL key orders raw values as arraySortMut does
+void arrayRadixSort(Array* array, ArrayRadixKey key, void* ctx);
+
+// Sorting an array in-place by several threads
+void arraySortParallel(Array* array, ArrayCompare cmp, void* ctx, size_t nthreads);
 
 // Expanding the capacity of the given array
 void arrayExpandCapacity(Array* array);
@@ -1,66 +1,68 @@
-/* 
+/*
     Implementations of popular sorting algorithms for Array data structure
 
-    ALL THESE ALGORITHMS ARE INTENDED TO SORT ONLY NUMERICAL ARRAYS.
+    Every algorithm sorts a buffer of a given size by a comparator,
+    if the comparator is NULL the raw values of elements are compared.
 */
 
+#include "basic.h"
+#include "array.h"
+
 #ifndef ARRAY_SORTINGS_H
 #define ARRAY_SORTINGS_H
 
+// Below this size introsort finishes a part of the buffer by insertion sort
+#define ARRAY_SORT_INSERTION_THRESHOLD 24
+
+// Above this size the pivot is the median of three medians
+#define ARRAY_SORT_NINTHER_THRESHOLD 128
+
+// Below this size radix sort gives the buffer to insertion sort, which keeps it stable
+#define ARRAY_RADIX_THRESHOLD 64
+
+// The width of a digit of radix sort in bits, and the number of digits of a key
+#define ARRAY_RADIX_BITS 8
+#define ARRAY_RADIX_DIGITS (64 / ARRAY_RADIX_BITS)
+
+// Below this size parallel sort sorts the buffer in the calling thread
+#define ARRAY_PARALLEL_THRESHOLD (1 << 16)
+
+// Below this size timsort sorts the buffer by binary insertion, and runs are extended to about this size
+#define ARRAY_TIMSORT_MIN_MERGE 64
+
+// How many elements in a row one run must win by, before a merge starts galloping
+#define ARRAY_TIMSORT_MIN_GALLOP 7
+
+// Upper limit of threads of parallel sort
+#define ARRAY_PARALLEL_MAX_THREADS 256
+
+// How many samples per thread are taken for choosing splitters
+#define ARRAY_PARALLEL_OVERSAMPLING 64
 
- void swap(void** a, void** b)
-{
-    int* temp = *a;
-    *a = *b;
-    *b = temp;
-}
 
 // Bubble sort algorithm
-void** bubbleSort(void** array, int size)
-{
-    bool swapped = true;
-    while (swapped) {
-        swapped = false;
-        for (int i = 0, j = 1; i < size && j < size; i++, j++) {
-            if (array[i] > array[j]) {
-                swap(&array[i], &array[j]);
-                swapped = true;
-            }
-        }
-    }
-    return array;
-}
+void bubbleSort(void** array, size_t size, ArrayCompare cmp, void* ctx);
 
 // Selection sort algorithm
-void** selectionSort(void** array, int size) 
-{ 
-    int i, j, min_idx;
- 
-    for (i = 0; i < size - 1; i++) 
-    { 
-        min_idx = i; 
-        for (j = i + 1; j < size; j++) 
-          if (array[j] < array[min_idx]) 
-            min_idx = j;
-        swap(&array[min_idx], &array[i]); 
-    }
-    return array;
-} 
+void selectionSort(void** array, size_t size, ArrayCompare cmp, void* ctx);
 
 // Insertion sort algorithm
-void** insertionSort(void** array, int size) 
-{ 
-    int i, j; 
-    for (i = 1; i < size; i++) { 
-        void* key = array[i]; 
-        j = i - 1;
-        while (j >= 0 && array[j] > key) { 
-            array[j + 1] = array[j]; 
-            j = j - 1; 
-        } 
-        array[j + 1] = key; 
-    }
-    return array;
-}
+void insertionSort(void** array, size_t size, ArrayCompare cmp, void* ctx);
+
+// Heap sort algorithm
+void heapSort(void** array, size_t size, ArrayCompare cmp, void* ctx);
+
+// Introsort algorithm, pattern-defeating quicksort with the heap sort fallback
+void introSort(void** array, size_t size, ArrayCompare cmp, void* ctx);
+
+// Timsort algorithm, stable and adaptive to sorted runs of the input
+void timSort(void** array, size_t size, ArrayCompare cmp, void* ctx);
+
+// LSD radix sort algorithm, stable, elements are ordered by their integer keys
+void radixSort(void** array, size_t size, ArrayRadixKey key, void* ctx);
+
+// Parallel sample sort algorithm, [cmp] is called from several threads at once
+void parallelSort(void** array, size_t size, ArrayCompare cmp, void* ctx, size_t nthreads);
+
 
 #endif // ARRAY_SORTINGS_H
@@ -10,6 +10,9 @@
 #include <string.h>
 #include <limits.h>
 
+// Size of the cache line, used to keep shared data of containers on separate lines
+#define CACHE_LINE_SIZE 64
+
 // Showing an error message to a user
 extern void panic(const char* message, ...);
 
@@ -1,56 +1,107 @@
-/* Insides of Binary Search Tree data structure */
+/* Insides of Binary Search Tree data structure (Base: red-black tree) */
 
 #include "basic.h"
+#include "array.h"
+#include "nodepool.h"
 
 #ifndef BIN_SEARCH_TREE_H_
 #define BIN_SEARCH_TREE_H_
 
-#define MAXSIZE 256
 #define bstreeSize(x) (x->size)
 
+// Colors of the nodes, a missing child is counted as a black node
+#define BSTREE_BLACK 0
+#define BSTREE_RED 1
+
+// Orders, in which the tree can be traversed
+typedef enum BSTOrder_type {
+    BSTREE_PREORDER,
+    BSTREE_INORDER,
+    BSTREE_POSTORDER,
+    BSTREE_LEVELORDER
+} BSTOrder;
+
+// Function, which is called for every value of a traversed tree
+typedef void (*BSTVisit)(void* value, void* ctx);
+
+// Comparator of two values, less than 0 means that [a] stands before [b]
+typedef int (*BSTCompare)(const void* a, const void* b);
+
 typedef struct Node_type {
     void* data;
     struct Node_type* left;
     struct Node_type* right;
+    struct Node_type* parent;
+    // The number of nodes in the subtree of this node, including itself
+    size_t size;
+    uint8_t color;
 } Node_t;
 
 typedef struct Tree_type {
     size_t size;
     Node_t* root;
+    // User comparator, if it is NULL the raw values are compared
+    BSTCompare cmp;
+    // The nodes of the tree are taken from this pool
+    NodePool pool;
 } BSTree;
 
 // New BST creation
-BSTree* bstreeNew();
+BSTree* bstreeNew(BSTCompare cmp);
 
-// New node creation
+// New node creation, the node is not owned by any tree
 Node_t* treeNodeNew(void* value);
 
+// Building a balanced tree from a sorted array
+BSTree* bstreeFromSortedArray(Array* array, BSTCompare cmp);
+
+// Creating an array of the values of a tree in the sorted order
+Array* bstreeToArray(BSTree* tree);
+
 // Append an element to the tree
 void bstreeAppend(BSTree* tree, void* value);
 
-// Helper insert function
-extern void _bstreeAppendNewNode__(Node_t* root, void* value);
-
 // Deleting an element from a tree
-void bstreeDelete(Node_t* root, void* value);
+void bstreeDelete(BSTree* tree, void* value);
 
 // Checking if a given tree contains a value or not
 bool bstreeSearch(BSTree* tree, void* value);
 
-// Helped search function
-extern bool _bstreeSearch__(Node_t* root, void* value);
+// Finding the first value not less than a given one
+bool bstreeLowerBound(BSTree* tree, void* value, void** result);
+
+// Finding the first value bigger than a given one
+bool bstreeUpperBound(BSTree* tree, void* value, void** result);
+
+// Finding the biggest value not bigger than a given one
+bool bstreeFloor(BSTree* tree, void* value, void** result);
+
+// Finding the smallest value not less than a given one
+bool bstreeCeiling(BSTree* tree, void* value, void** result);
+
+// Getting the value standing at a given position in the sorted order
+void* bstreeSelect(BSTree* tree, size_t index);
+
+// Getting the number of values less than a given one
+size_t bstreeRank(BSTree* tree, void* value);
+
+// Getting the number of values within given bounds, both included
+size_t bstreeRangeCount(BSTree* tree, void* low, void* high);
 
 // Traverse a given tree in preorder
-int* bstreePreorderTraversal(Node_t* root);
+void bstreePreorderTraversal(BSTree* tree, BSTVisit visit, void* ctx);
 
 // Traverse a given tree in postorder
-int* bstreePostorderTraversal(Node_t* root);
+void bstreePostorderTraversal(BSTree* tree, BSTVisit visit, void* ctx);
 
 // Traverse a given tree in inorder
-int* bstreeInorderTraversal(Node_t* root);
+void bstreeInorderTraversal(BSTree* tree, BSTVisit visit, void* ctx);
 
 // Traverse a given tree in levelorder
-int* bstreeLevelorderTraversal(Node_t* root);
+void bstreeLevelorderTraversal(BSTree* tree, BSTVisit visit, void* ctx);
+
+// Appending the values of a given tree in a given order to an array
+void bstreeTraversalToArray(BSTree* tree, BSTOrder order, Array* array);
 
 // Finding a minimum depth of a given tree
 int bstreeMinDepth(Node_t* root);
@@ -61,8 +112,48 @@ int bstreeMaxDepth(Node_t* root);
 // Checking if a given tree is empty or not
 bool bstreeIsEmpty(BSTree* tree);
 
-// Checking if a given tree is full or not
-bool bstreeIsFull(BSTree* tree);
+// Removing all elements from a given tree
+void bstreeClear(BSTree* tree);
+
+// Deleting a given tree
+void bstreeFree(BSTree* tree);
+
+//////////////////////////////////////
+
+
+// Wrapper for BSTree type, walks the values in a given order
+typedef struct BSTreeIter_type {
+    // A tree that should be wrapped in
+    BSTree* tree;
+    BSTOrder order;
+
+    // The node, the value of which is returned next, NULL at the end
+    Node_t* next;
+
+    // The queue of nodes for levelorder, NULL for the other orders
+    Node_t** queue;
+    size_t queue_head;
+    size_t queue_tail;
+
+    // If it is set, the iterator stops after the values bigger than [high]
+    bool bounded;
+    void* high;
+} BSTreeIterator;
+
+// Iterator starting from the first value of a given order
+BSTreeIterator* bstreeIterNew(BSTree* tree, BSTOrder order);
+
+// Iterator walking the values within given bounds in sorted order
+BSTreeIterator* bstreeRangeIterNew(BSTree* tree, void* low, void* high);
+
+// Check if a given iterator has next value
+bool bstreeIterHasNext(BSTreeIterator* iterator);
+
+// Getting the next value of iterator
+void* bstreeIterNext(BSTreeIterator* iterator);
+
+// Deleting a given iterator
+void bstreeIterDelete(BSTreeIterator* iterator);
 
 
-#endif // BIN_SEARCH_TREE_H_
\ No newline at end of file
+#endif // BIN_SEARCH_TREE_H_
@@ -0,0 +1,110 @@
+/* Insides of B+ Tree data structure (ordered map with cache-line-sized nodes) */
+
+#include "basic.h"
+#include "array.h"
+
+#ifndef B_PLUS_TREE_H
+#define B_PLUS_TREE_H
+
+// The number of keys of a node, so that a node takes exactly 256 bytes, i.e. four cache lines
+#define BPT_NODE_KEYS 15
+#define BPT_NODE_CHILDREN (BPT_NODE_KEYS + 1)
+
+// Every node except the root keeps at least this number of keys
+#define BPT_MIN_KEYS (BPT_NODE_KEYS / 2)
+
+// The biggest height of the tree, more than enough for any number of keys
+#define BPT_MAX_HEIGHT 32
+
+#define bptreeSize(x) (x->size)
+#define bptreeHeight(x) (x->height)
+
+// Comparator of two keys, less than 0 means that [a] stands before [b]
+typedef int (*BPTCompare)(const void* a, const void* b);
+
+// Node of the tree, inner nodes keep children, leaves keep values and a link to the next leaf
+typedef struct BPTNode_type {
+    uint32_t count;
+    bool leaf;
+    // Sorted keys; in an inner node the keys of [children[i]] are less than [keys[i]], and the keys of [children[i + 1]] are not
+    void* keys[BPT_NODE_KEYS];
+    union {
+        struct BPTNode_type* children[BPT_NODE_CHILDREN];
+        struct {
+            void* values[BPT_NODE_KEYS];
+            struct BPTNode_type* next;
+        };
+    };
+} BPTNode;
+
+// B+ tree data structure
+typedef struct BPTree_type {
+    // The number of keys in the tree
+    size_t size;
+    // The number of levels, a single leaf has the height 1
+    size_t height;
+    BPTNode* root;
+    // The leftmost leaf, the scans start from it
+    BPTNode* first;
+    // User comparator, if it is NULL the raw values of keys are compared
+    BPTCompare cmp;
+} BPTree;
+
+
+// New B+ tree creation
+BPTree* bptreeNew(BPTCompare cmp);
+
+// Building a tree from sorted unique keys and their values
+BPTree* bptreeFromSortedArray(Array* keys, Array* values, BPTCompare cmp);
+
+// Inserting a key with a value, or replacing the value of an existing key
+bool bptreeInsert(BPTree* tree, void* key, void* value);
+
+// Searching a value of a given key
+bool bptreeFind(BPTree* tree, void* key, void** value);
+
+// Checking if tree contains a given key or not
+bool bptreeContains(BPTree* tree, void* key);
+
+// Remove a given key from the tree
+bool bptreeErase(BPTree* tree, void* key);
+
+// Checking if tree is empty or not
+bool bptreeIsEmpty(BPTree* tree);
+
+// Clearing a given tree
+void bptreeClear(BPTree* tree);
+
+// Deleting a given tree
+void bptreeDelete(BPTree* tree);
+
+//////////////////////////////////////
+
+
+// Wrapper for B+ tree type, walks the keys in order by the leaf links
+typedef struct BPTreeIter_type {
+    // A tree that should be wrapped in
+    BPTree* tree;
+
+    // The leaf and the position in it of the next key
+    BPTNode* leaf;
+    size_t curr_index;
+} BPTreeIterator;
+
+// Iterator starting from the smallest key
+BPTreeIterator* bptreeIterNew(BPTree* tree);
+
+// Moving the iterator to the first key not less than a given one
+void bptreeIterSeek(BPTreeIterator* iterator, void* key);
+
+// Check if a given iterator has next key
+bool bptreeIterHasNext(BPTreeIterator* iterator);
+
+// Getting the next key of iterator and its value
+void* bptreeIterNext(BPTreeIterator* iterator, void** value);
+
+// Deleting a given iterator
+void bptreeIterDelete(BPTreeIterator* iterator);
+
+
+#endif // B_PLUS_TREE_H
@@ -0,0 +1,87 @@
+/* Insides of Concurrent Hash Table data structure (lock-free reads, striped writes) */
+
+#include "basic.h"
+#include "hashtable.h"
+#include <stdatomic.h>
+#include <pthread.h>
+
+#ifndef CONCURRENT_HASH_TABLE_H
+#define CONCURRENT_HASH_TABLE_H
+
+// The number of writer locks, every lock guards the buckets with the same low bits
+#define CHT_STRIPES 64
+
+// The start number of buckets, always a power of two and not less than CHT_STRIPES
+#define CHT_STANDARD_CAPACITY 64
+
+// The biggest number of buckets
+#define CHT_MAX_CAPACITY ((size_t)1 << 30)
+
+// How many buckets a thread takes at once when it helps to move the table
+#define CHT_TRANSFER_CHUNK 64
+
+// Memory which is freed only when no reader can see it anymore
+typedef struct CHTRetired_type {
+    struct CHTRetired_type* next;
+    void (*destroy)(struct CHTRetired_type* retired);
+} CHTRetired;
+
+// Node of a bucket chain, only [value] and [next] can be changed after it is published
+typedef struct CHTNode_type {
+    CHTRetired retired;
+    void* key;
+    size_t hash;
+    _Atomic(void*) value;
+    _Atomic(struct CHTNode_type*) next;
+} CHTNode;
+
+// Array of buckets, during a resize it points to the next, twice bigger one
+typedef struct CHTTable_type {
+    CHTRetired retired;
+    size_t capacity;
+    size_t mask;
+    _Atomic(CHTNode*)* buckets;
+    _Atomic(struct CHTTable_type*) next;
+    // The first bucket which is not taken by any helper yet, and how many are moved
+    atomic_size_t transfer_index;
+    atomic_size_t transfer_done;
+} CHTTable;
+
+// Writer lock and the number of elements in the buckets it guards
+typedef struct CHTStripe_type {
+    _Alignas(CACHE_LINE_SIZE) pthread_mutex_t lock;
+    atomic_size_t count;
+} CHTStripe;
+
+// Concurrent hash table data structure
+typedef struct ConcurrentHashTable_type {
+    _Atomic(CHTTable*) table;
+    HTHash hash;
+    HTEqual equal;
+    CHTStripe* stripes;
+} ConcurrentHashTable;
+
+
+// New concurrent hash table creation
+ConcurrentHashTable* chtNew(HTHash hash, HTEqual equal);
+
+// Inserting a key with a value, or replacing the value of an existing key
+bool chtInsert(ConcurrentHashTable* cht, void* key, void* value);
+
+// Searching a value of a given key, never takes a lock
+bool chtFind(ConcurrentHashTable* cht, void* key, void** value);
+
+// Checking if table contains a given key or not, never takes a lock
+bool chtContains(ConcurrentHashTable* cht, void* key);
+
+// Remove a given key from the table
+bool chtErase(ConcurrentHashTable* cht, void* key);
+
+// Getting the number of elements of the table
+size_t chtSize(ConcurrentHashTable* cht);
+
+// Deleting a given table
+void chtDelete(ConcurrentHashTable* cht);
+
+
+#endif // CONCURRENT_HASH_TABLE_H
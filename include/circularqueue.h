@@ -1 +1,59 @@
+/* Insides of bounded lock-free Circular Queue data structure (single producer, single consumer) */
 
+#include "basic.h"
+#include <stdatomic.h>
+
+#ifndef CIRCULAR_QUEUE_H
+#define CIRCULAR_QUEUE_H
+
+// The biggest capacity that can be requested for a circular queue
+#define CQUEUE_MAX_CAPACITY ((size_t)1 << 30)
+
+#define cqueueCapacity(x) (x->capacity)
+
+// Circular queue data structure based on a fixed ring buffer
+typedef struct CircularQueue_type {
+    // Producer side: the next slot to write, and the last head seen by the producer
+    _Alignas(CACHE_LINE_SIZE) atomic_size_t tail;
+    size_t cached_head;
+
+    // Consumer side: the next slot to read, and the last tail seen by the consumer
+    _Alignas(CACHE_LINE_SIZE) atomic_size_t head;
+    size_t cached_tail;
+
+    // Never changed after creation, so shared by both sides without traffic
+    _Alignas(CACHE_LINE_SIZE) size_t capacity;
+    size_t mask;
+    void **buff;
+} CircularQueue;
+
+
+// New circular queue creation
+CircularQueue* cqueueNew(size_t capacity);
+
+// Appending an element to the end of queue if there is a free slot (producer only)
+bool cqueueTryPush(CircularQueue* queue, void* item);
+
+// Remove the first element of queue if there is any (consumer only)
+bool cqueueTryPop(CircularQueue* queue, void** item);
+
+// Appending up to [count] elements to the end of queue (producer only)
+size_t cqueueTryPushN(CircularQueue* queue, void** items, size_t count);
+
+// Remove up to [count] first elements of queue (consumer only)
+size_t cqueueTryPopN(CircularQueue* queue, void** items, size_t count);
+
+// Getting the size of queue
+size_t cqueueSize(CircularQueue* queue);
+
+// Checking if queue is empty or not
+bool cqueueIsEmpty(CircularQueue* queue);
+
+// Checking if queue is full or not
+bool cqueueIsFull(CircularQueue* queue);
+
+// Deleting a given queue
+void cqueueDelete(CircularQueue* queue);
+
+
+#endif // CIRCULAR_QUEUE_H
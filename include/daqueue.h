@@ -11,11 +11,24 @@
 // Denote maximum capacity for the queue just for controlling size of allocated memory
 #define MAXSIZE INT_MAX
 
-// Queue data structure based on Dynamic Array
+// The capacity of the ring is always a power of two, so this is the start one
+#define DA_QUEUE_CAPACITY 16
+
+// The biggest power of two which is not bigger than MAXSIZE
+#define DA_QUEUE_MAX_CAPACITY ((size_t)1 << 30)
+
+// Wrapping an index of the ring, works only for a power of two capacity
+#define daQueueWrap(x, i) ((i) & ((x)->capacity - 1))
+
+// Queue data structure based on Dynamic Array used as a circular buffer
 typedef struct Queue_type {
     size_t size;
     size_t capacity;
     double exp_val;
+    // Index of the first element of the queue
+    size_t head;
+    // Index of the slot the next enqueued element will be written to
+    size_t tail;
     void **buff;
 } Queue;
 
@@ -44,10 +57,10 @@ size_t daQueueSize(Queue* queue);
 // Checking if queue is empty or not
 bool daQueueIsEmpty(Queue* queue);
 
-// Checking if queue is full or not
+// Checking if queue is full or not, i.e. keeps DA_QUEUE_MAX_CAPACITY elements
 bool daQueueIsFull(Queue* queue);
 
-// Checking if the size of queue is less than the MAXSIZE or not
+// Checking if the size of queue is not bigger than the DA_QUEUE_MAX_CAPACITY or not
 bool daQueueSizeIsValid(Queue* queue);
 
 // Expanding capacity of a given queue
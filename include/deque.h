@@ -11,11 +11,24 @@
 // Denote maximum capacity for the queue just for controlling size of allocated memory
 #define MAXSIZE INT_MAX
 
-// Deque data structure based on Dynamic Array
+// The capacity of the ring is always a power of two, so this is the start one
+#define DEQUE_CAPACITY 16
+
+// The biggest power of two which is not bigger than MAXSIZE
+#define DEQUE_MAX_CAPACITY ((size_t)1 << 30)
+
+// Wrapping an index of the ring, works only for a power of two capacity
+#define dequeWrap(x, i) ((i) & ((x)->capacity - 1))
+
+// Deque data structure based on Dynamic Array used as a circular buffer
 typedef struct Deque_type {
 	size_t size;
 	size_t capacity;
 	double exp_val;
+	// Index of the first element of the deque
+	size_t head;
+	// Index of the slot right after the last element of the deque
+	size_t tail;
 	void **buff;
 } Deque;
 
@@ -44,16 +57,19 @@ void* dequeFront(Deque* deque);
 // Getting the last element of deque
 void* dequeRear(Deque* deque);
 
+// Getting an element standing on a specific position
+void* dequeAt(Deque* deque, size_t index);
+
 // Getting the size of deque
 size_t dequeSize(Deque* deque);
 
 // Checking if deque is empty or not
 bool dequeIsEmpty(Deque* deque);
 
-// Checking if deque is full or not
+// Checking if deque is full or not, i.e. keeps DEQUE_MAX_CAPACITY elements
 bool dequeIsFull(Deque* deque);
 
-// Checking if the size of deque is less than the MAXSIZE or not
+// Checking if the size of deque is not bigger than the DEQUE_MAX_CAPACITY or not
 bool dequeSizeIsValid(Deque* deque);
 
 // Expanding capacity of a given queue
@@ -68,5 +84,35 @@ void dequeCutCapacity(Deque* deque);
 // Clearing a given deque
  void dequeDelete(Deque* deque);
 
+//////////////////////////////////////
+
+
+// Wrapper for Deque type
+typedef struct DequeIter_type {
+    // A deque that should be wrapped in
+    Deque* deque;
+
+    // Position of iterator pointer, i.e. how many elements are already passed
+    size_t curr_index;
+} DequeIterator;
+
+// Just something like Python's iter()
+DequeIterator* dequeIterNew(Deque* deque);
+
+// Check if a given deque has next element
+bool dequeIterHasNext(DequeIterator* iterator);
+
+// Check if a given deque has prev element
+bool dequeIterHasPrev(DequeIterator* iterator);
+
+// Getting the next element of iterator
+void* dequeIterNext(DequeIterator* iterator);
+
+// Getting the previous element of iterator
+void* dequeIterPrev(DequeIterator* iterator);
+
+// Deleting a given iterator, the wrapped deque stays untouched
+void dequeIterDelete(DequeIterator* iterator);
+
 
 #endif // _DOUBLE_END_Q_H_
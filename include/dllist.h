@@ -1,6 +1,7 @@
 /* Insides of Doubly Linked List data structure */
 
 #include "basic.h"
+#include "nodepool.h"
 
 #ifndef DOUBLY_LINKED_LIST_H
 #define DOUBLY_LINKED_LIST_H
@@ -19,13 +20,21 @@ typedef struct DLL_type {
     size_t size;
     Node* head;
     Node* tail;
+    // The nodes of the list are taken from this pool
+    NodePool pool;
 } DList;
 
+// Comparator of two elements, less than 0 means that [a] stands before [b]
+typedef int (*DListCompare)(const void* a, const void* b, void* ctx);
+
+// Sorting function, e.g. dlistMergeSort
+typedef void (*DListSortFunc)(DList* list, DListCompare cmp, void* ctx);
+
 
 // New list creation
 DList* dlistNew();
 
-// New node creation
+// New node creation, the node is not owned by any list
 Node* dnodeNew(void* value);
 
 // Appending an element to the end of the list
@@ -85,6 +94,9 @@ bool dlistContains(DList* list, void* value);
 // Making a shallow copy of a given list
 DList* dlistCopy(DList* list);
 
+// Making a deep copy of a given list
+DList* dlistDeepCopy(DList* list);
+
 // Reversing an list in-place 
 void dlistReverseMut(DList* list);
 
@@ -109,6 +121,15 @@ void dlistExtend(DList* f_list, DList* s_list);
 // Swapping two lists
 void dswapLists(DList* f_list, DList* s_list);
 
+// Merge sort algorithm, stable, relinks nodes and allocates nothing
+void dlistMergeSort(DList* list, DListCompare cmp, void* ctx);
+
+// Sorting a given list 'in-place' by a chosen sort function, merge sort if it is NULL
+void dlistSortMut(DList* list, DListSortFunc func, DListCompare cmp, void* ctx);
+
+// Creating a copy, sorting it by a chosen sort function and return
+DList* dlistSortNew(DList* list, DListSortFunc func, DListCompare cmp, void* ctx);
+
 // Clear list
 void dlistClear(DList* list);
 
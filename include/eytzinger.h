@@ -0,0 +1,51 @@
+/* Insides of Eytzinger Index data structure (frozen search index in BFS layout) */
+
+#include "basic.h"
+#include "array.h"
+
+#ifndef EYTZINGER_INDEX_H
+#define EYTZINGER_INDEX_H
+
+// How many lookups of a batch descend at once
+#define EYTZ_BATCH_SIZE 8
+
+#define eytzSize(x) (x->size)
+
+// Comparator of two keys, less than 0 means that [a] stands before [b]
+typedef int (*EytzCompare)(const void* a, const void* b);
+
+// Immutable search index, the keys stand in the order of a breadth-first walk of a balanced tree
+typedef struct EytzingerIndex_type {
+    // The number of keys
+    size_t size;
+    // How many steps every descent makes before the last, maybe incomplete, level
+    size_t full_steps;
+    // User comparator, if it is NULL the raw values of keys are compared
+    EytzCompare cmp;
+    // The keys, the children of [k] stand at [2k] and [2k + 1], [keys[0]] is unused
+    void** keys;
+    // The position in the sorted order of the key standing at the same place
+    size_t* ranks;
+} EytzingerIndex;
+
+
+// New index creation from sorted keys
+EytzingerIndex* eytzNew(Array* keys, EytzCompare cmp);
+
+// Getting the sorted position of the first key not less than a given one
+size_t eytzLowerBound(EytzingerIndex* index, void* key);
+
+// Getting the lower bounds of many keys at once
+void eytzLowerBoundBatch(EytzingerIndex* index, void** keys, size_t count, size_t* ranks);
+
+// Searching the sorted position of a given key
+bool eytzFind(EytzingerIndex* index, void* key, size_t* rank);
+
+// Checking if index contains a given key or not
+bool eytzContains(EytzingerIndex* index, void* key);
+
+// Deleting a given index
+void eytzDelete(EytzingerIndex* index);
+
+
+#endif // EYTZINGER_INDEX_H
@@ -1 +1,111 @@
+/* Insides of Hash Table data structure (open addressing, Swiss table) */
 
+#include "basic.h"
+
+#ifndef HASH_TABLE_H
+#define HASH_TABLE_H
+
+// The number of slots whose control bytes are probed at once
+#define HT_GROUP_WIDTH 16
+
+// The start capacity of the table, always a power of two and a multiple of the group width
+#define HT_STANDARD_CAPACITY 16
+
+// The biggest capacity of the table
+#define HT_MAX_CAPACITY ((size_t)1 << 30)
+
+// How many groups of the old storage are moved by every operation during an incremental rehash
+#define HT_REHASH_STEP 4
+
+// Control bytes of the slots which keep no element
+#define HT_CTRL_EMPTY ((int8_t)-128)
+#define HT_CTRL_DELETED ((int8_t)-2)
+
+#define htSize(x) (x->size)
+#define htCapacity(x) (x->capacity)
+
+// Hash function of a key
+typedef size_t (*HTHash)(const void* key);
+
+// Equality function of two keys
+typedef bool (*HTEqual)(const void* a, const void* b);
+
+// One slot of the table
+typedef struct HTSlot_type {
+    void* key;
+    void* value;
+} HTSlot;
+
+// Hash table data structure
+typedef struct HashTable_type {
+    // The number of elements in the table
+    size_t size;
+    // The number of slots, always a power of two
+    size_t capacity;
+    // How many elements can be put into empty slots before the table is rehashed
+    size_t growth_left;
+    // User hash and equality functions, if they are NULL raw keys are used
+    HTHash hash;
+    HTEqual equal;
+    // Control byte of every slot: empty, deleted, or 7 bits of the hash of its key
+    int8_t* ctrl;
+    // Keys and values, standing at the same positions as their control bytes
+    HTSlot* slots;
+    // If it is set, the elements are moved to a new storage step by step
+    bool incremental;
+    // The storage which is being moved during an incremental rehash, NULL otherwise
+    int8_t* old_ctrl;
+    HTSlot* old_slots;
+    size_t old_capacity;
+    // The first group of the old storage which is not moved yet
+    size_t migrate_pos;
+} HashTable;
+
+
+// New hash table creation
+HashTable* htNew(HTHash hash, HTEqual equal);
+
+// Inserting a key with a value, or replacing the value of an existing key
+bool htInsert(HashTable* ht, void* key, void* value);
+
+// Searching a value of a given key
+bool htFind(HashTable* ht, void* key, void** value);
+
+// Checking if table contains a given key or not
+bool htContains(HashTable* ht, void* key);
+
+// Remove a given key from the table
+bool htErase(HashTable* ht, void* key);
+
+// Reserving the place for at least a given number of elements
+void htReserve(HashTable* ht, size_t count);
+
+// Turning the incremental rehashing on or off
+void htSetIncremental(HashTable* ht, bool incremental);
+
+// Moving up to a given number of groups during an incremental rehash
+bool htStepRehash(HashTable* ht, size_t budget);
+
+// Checking if an incremental rehash is in progress or not
+bool htIsRehashing(HashTable* ht);
+
+// Calling a given function for every element of the table
+void htForEach(HashTable* ht, void (*visit)(void* key, void* value, void* ctx), void* ctx);
+
+// Checking if table is empty or not
+bool htIsEmpty(HashTable* ht);
+
+// Hash function for null-terminated strings
+size_t htHashString(const void* key);
+
+// Equality function for null-terminated strings
+bool htEqualString(const void* a, const void* b);
+
+// Clearing a given table
+void htClear(HashTable* ht);
+
+// Deleting a given table
+void htDelete(HashTable* ht);
+
+
+#endif // HASH_TABLE_H
@@ -0,0 +1,94 @@
+/* Insides of Intrusive Doubly Linked List (the links are embedded in user's structures) */
+
+#include "basic.h"
+#include <stddef.h>
+
+#ifndef INTRUSIVE_LINKED_LIST_H
+#define INTRUSIVE_LINKED_LIST_H
+
+// Getting a pointer to the structure of [type], whose field [member] is pointed by [ptr]
+#define ilistEntry(ptr, type, member) \
+  ((type*)((char*)(ptr) - offsetof(type, member)))
+
+// Walking the links of a list from the beginning, [pos] must not be unlinked in the body
+#define ilistForEach(pos, list) \
+  for ((pos) = (list)->head.next; (pos) != &(list)->head; (pos) = (pos)->next)
+
+// Walking the links of a list from the end
+#define ilistForEachReverse(pos, list) \
+  for ((pos) = (list)->head.prev; (pos) != &(list)->head; (pos) = (pos)->prev)
+
+// Walking the links of a list, [pos] may be unlinked in the body, [tmp] keeps the next link
+#define ilistForEachSafe(pos, tmp, list) \
+  for ((pos) = (list)->head.next, (tmp) = (pos)->next; (pos) != &(list)->head; (pos) = (tmp), (tmp) = (pos)->next)
+
+// Walking the structures of [type] linked through their field [member]
+#define ilistForEachEntry(pos, list, type, member) \
+  for ((pos) = ilistEntry((list)->head.next, type, member); &(pos)->member != &(list)->head; \
+       (pos) = ilistEntry((pos)->member.next, type, member))
+
+// Link structure, should be a field of a structure that is stored in a list
+typedef struct IListLink_type {
+    struct IListLink_type* next;
+    struct IListLink_type* prev;
+} IListLink;
+
+// Intrusive list structure, the list is a ring closed by the [head] link
+typedef struct IList_type {
+    IListLink head;
+} IList;
+
+
+// Initialization of an empty list
+void ilistInit(IList* list);
+
+// Initialization of a link, that is not in any list
+void ilistLinkInit(IListLink* link);
+
+// Check if a link is in some list or not
+bool ilistIsLinked(IListLink* link);
+
+// Check if a list is empty or not
+bool ilistIsEmpty(IList* list);
+
+// Getting the number of links of a list
+size_t ilistLength(IList* list);
+
+// Appending a link to the end of the list
+void ilistPush(IList* list, IListLink* link);
+
+// Appending a link to the beginning of the list
+void ilistPrepend(IList* list, IListLink* link);
+
+// Inserting a link after another one
+void ilistInsertAfter(IListLink* pos, IListLink* link);
+
+// Inserting a link before another one
+void ilistInsertBefore(IListLink* pos, IListLink* link);
+
+// Removing a link from its list
+void ilistUnlink(IListLink* link);
+
+// Getting the first link of a given list
+IListLink* ilistGetBegin(IList* list);
+
+// Getting the last link of a given list
+IListLink* ilistGetEnd(IList* list);
+
+// Remove the last link from list and return it
+IListLink* ilistPop(IList* list);
+
+// Remove the first link from list and return it
+IListLink* ilistPoll(IList* list);
+
+// Moving all links of the second list to the end of the first one
+void ilistSplice(IList* f_list, IList* s_list);
+
+// Moving all links of a list before a given link
+void ilistSpliceBefore(IListLink* pos, IList* list);
+
+// Swapping two lists
+void iswapLists(IList* f_list, IList* s_list);
+
+
+#endif // INTRUSIVE_LINKED_LIST_H
@@ -0,0 +1,30 @@
+/*
+    Merge sort shared by the linked lists, see "src/list_sortings.c"
+
+    It sorts a chain of nodes linked by [next] and doesn't depend on a node
+    type, the places of the element and of the link inside of a node are
+    given by their offsets. Every list restores its own other links after it.
+*/
+
+#include "basic.h"
+#include <stddef.h>
+
+#ifndef LIST_MERGE_H
+#define LIST_MERGE_H
+
+// How many sorted sublists merge sort keeps at once, enough for 2^64 nodes
+#define LIST_MERGE_BINS 64
+
+// Places of the element and of the [next] link inside of a node, both are pointers
+typedef struct ListNodeLayout_type {
+    size_t data;
+    size_t next;
+} ListNodeLayout;
+
+
+// Merge sort of a NULL terminated chain of nodes, stable, relinks nodes and allocates nothing
+void* listMergeChain(void* head, const ListNodeLayout* layout,
+    int (*cmp)(const void* a, const void* b, void* ctx), void* ctx, void** tail);
+
+
+#endif // LIST_MERGE_H
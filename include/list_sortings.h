@@ -1,59 +1,26 @@
-/* 
+/*
     Implementations of popular sorting algorithms for Singly Linked List data structure
 
-    ALL THESE ALGORITHMS ARE INTENDED TO SORT ONLY NUMERICAL ARRAYS.
+    Every algorithm sorts a list by a comparator,
+    if the comparator is NULL the raw values of elements are compared.
 */
 
+#include "basic.h"
+#include "sllist.h"
+#include "list_merge.h"
+
 #ifndef LIST_SORTINGS_H
 #define LIST_SORTINGS_H
 
 
-void swap(void** a, void** b)
-{
-    int* temp = *a;
-    *a = *b;
-    *b = temp;
-}
-
 // Bubble sort algorithm
-List* bubbleSort(List* list)
-{
-    bool swapped = true;
-    while (swapped) {
-        swapped = false;
-        Node* curr_node = list->head;
-        while (curr_node->next) {
-            Node* next_node = curr_node->next;
-            if (curr_node->data > next_node->data) {
-                swap(&curr_node->data, &next_node->data);
-                swapped = true;
-            }
-            curr_node = curr_node->next;
-        }
-    }
-    return list;
-}
+void listBubbleSort(List* list, ListCompare cmp, void* ctx);
 
 // Selection sort algorithm
-List* selectionSort(List* list)
-{
-    Node* head = list->head;
-    while (head) {
-        Node* min = head;
-        Node* next_node = head->next;
-        while (next_node) {
-            if (min->data > next_node->data) {
-                min = next_node;
-            }
-            next_node = next_node->next;
-        }
-        void* data = head->data; 
-        head->data = min->data; 
-        min->data = data; 
-        head = head->next;
-    }
-    return list;
-}
-
-
-#endif // LIST_SORTINGS_H
\ No newline at end of file
+void listSelectionSort(List* list, ListCompare cmp, void* ctx);
+
+// Merge sort algorithm, stable, relinks nodes and allocates nothing
+void listMergeSort(List* list, ListCompare cmp, void* ctx);
+
+
+#endif // LIST_SORTINGS_H
@@ -0,0 +1,71 @@
+/* Insides of bounded lock-free MPMC Queue data structure (multiple producers, multiple consumers) */
+
+#include "basic.h"
+#include <stdatomic.h>
+#include <pthread.h>
+
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+// The biggest capacity that can be requested for a MPMC queue
+#define MPMC_QUEUE_MAX_CAPACITY ((size_t)1 << 30)
+
+// How many times a blocking call retries before the thread is parked
+#define MPMC_QUEUE_SPIN_LIMIT 128
+
+#define mpmcQueueCapacity(x) (x->capacity)
+
+// One slot of the ring, the sequence tells which lap of the ring the slot is ready for
+typedef struct MPMCCell_type {
+    atomic_size_t sequence;
+    void* data;
+} MPMCCell;
+
+// MPMC queue data structure based on a fixed ring buffer
+typedef struct MPMCQueue_type {
+    // Position of the next enqueue, shared by all producers
+    _Alignas(CACHE_LINE_SIZE) atomic_size_t tail;
+
+    // Position of the next dequeue, shared by all consumers
+    _Alignas(CACHE_LINE_SIZE) atomic_size_t head;
+
+    // Never changed after creation
+    _Alignas(CACHE_LINE_SIZE) size_t capacity;
+    size_t mask;
+    MPMCCell* cells;
+
+    // Used only by the blocking calls, when a thread has to be parked
+    atomic_size_t push_waiters;
+    atomic_size_t pop_waiters;
+    pthread_mutex_t park_lock;
+    pthread_cond_t not_full;
+    pthread_cond_t not_empty;
+} MPMCQueue;
+
+
+// New MPMC queue creation
+MPMCQueue* mpmcQueueNew(size_t capacity);
+
+// Appending an element to the end of queue if there is a free slot
+bool mpmcQueueTryPush(MPMCQueue* queue, void* item);
+
+// Remove the first element of queue if there is any
+bool mpmcQueueTryPop(MPMCQueue* queue, void** item);
+
+// Appending an element to the end of queue, waiting for a free slot
+void mpmcQueuePush(MPMCQueue* queue, void* item);
+
+// Remove and return the first element of queue, waiting for an element
+void* mpmcQueuePop(MPMCQueue* queue);
+
+// Getting the size of queue
+size_t mpmcQueueSize(MPMCQueue* queue);
+
+// Checking if queue is empty or not
+bool mpmcQueueIsEmpty(MPMCQueue* queue);
+
+// Deleting a given queue
+void mpmcQueueDelete(MPMCQueue* queue);
+
+
+#endif // MPMC_QUEUE_H
@@ -0,0 +1,58 @@
+/* Insides of Node Pool (slab allocator of equal-sized nodes for linked containers) */
+
+#include "basic.h"
+#include <stddef.h>
+
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+// How many nodes the first slab of a pool holds, every next slab is twice bigger
+#define POOL_FIRST_SLAB_NODES 32
+
+// Upper limit of nodes in one slab
+#define POOL_MAX_SLAB_NODES 4096
+
+// Block of memory, from which nodes are carved
+typedef struct NodeSlab_type {
+    struct NodeSlab_type* next;
+    max_align_t nodes[];
+} NodeSlab;
+
+// Pool of nodes of one size, it is kept inside of a container
+typedef struct NodePool_type {
+    // The size of one node, rounded up to keep nodes aligned
+    size_t node_size;
+    // The alignment of every node, 0 if only the one of malloc is needed
+    size_t align;
+    // How many nodes the next slab should hold
+    size_t slab_nodes;
+    // Freed nodes, linked through their first bytes
+    void* free_list;
+    // The unused rest of the newest slab
+    char* bump;
+    char* bump_end;
+    // All slabs of the pool
+    NodeSlab* slabs;
+} NodePool;
+
+
+// Initialization of a pool for nodes of a given size
+void poolInit(NodePool* pool, size_t node_size);
+
+// Initialization of a pool, every node of which starts at a given alignment
+void poolInitAligned(NodePool* pool, size_t node_size, size_t align);
+
+// Taking a node from a pool
+void* poolAlloc(NodePool* pool);
+
+// Taking a number of neighbour nodes from a pool at once
+void* poolAllocBlock(NodePool* pool, size_t count);
+
+// Giving a node back to its pool
+void poolFree(NodePool* pool, void* node);
+
+// Freeing all nodes of a pool at once
+void poolRelease(NodePool* pool);
+
+
+#endif // NODE_POOL_H
@@ -1 +1,96 @@
+/* Insides of Priority Queue data structure with base Binary Heap */
 
+#include "basic.h"
+#include "array.h"
+
+#ifndef PRIORITY_QUEUE_H
+#define PRIORITY_QUEUE_H
+
+#define pqSize(x) (x->size)
+
+// Comparator of two elements, less than 0 means that [a] should be popped before [b]
+typedef int (*PQCompare)(const void* a, const void* b, void* ctx);
+
+// Handle of an element in the queue, stays valid until the element is popped or removed
+typedef size_t PQHandle;
+
+// Handle that never belongs to any element
+#define PQ_INVALID_HANDLE ((PQHandle)SIZE_MAX)
+
+// Priority queue data structure based on Binary Heap stored in Dynamic Array
+typedef struct PriorityQueue_type {
+    // The number of elements in the heap
+    size_t size;
+    // The capacity of the heap buffer
+    size_t capacity;
+    // The expansion value, i.e. how rapidly the capacity will expand
+    double exp_val;
+    // User comparator, if it is NULL the raw values of elements are compared
+    PQCompare cmp;
+    // User data, which is passed to every call of the comparator
+    void* ctx;
+    // The heap itself, the children of [i] are standing at [2i + 1] and [2i + 2]
+    void **buff;
+    // Handle of the element standing at the same position of the heap
+    PQHandle *handles;
+    // Position map, i.e. where the element with a given handle stands in the heap
+    size_t *positions;
+    // How many handles were ever given out, and the head of the list of freed ones
+    size_t handles_count;
+    PQHandle free_handle;
+} PriorityQueue;
+
+
+// New priority queue creation
+PriorityQueue* pqNew(PQCompare cmp, void* ctx);
+
+// New priority queue creation using a given array
+PriorityQueue* pqFromArray(Array* array, PQCompare cmp, void* ctx);
+
+// Appending an element to the queue and return its handle
+PQHandle pqPush(PriorityQueue* pq, void* item);
+
+// Appending a batch of elements to the queue
+void pqPushN(PriorityQueue* pq, void** items, size_t count);
+
+// Remove and return the element with the highest priority
+void* pqPop(PriorityQueue* pq);
+
+// Getting the element with the highest priority
+void* pqPeek(PriorityQueue* pq);
+
+// Getting the handle of the element with the highest priority
+PQHandle pqPeekHandle(PriorityQueue* pq);
+
+// Checking if a given handle belongs to an element of queue
+bool pqContainsHandle(PriorityQueue* pq, PQHandle handle);
+
+// Getting the element with a given handle
+void* pqGetByHandle(PriorityQueue* pq, PQHandle handle);
+
+// Replacing an element by one with the same or higher priority
+void pqDecreaseKey(PriorityQueue* pq, PQHandle handle, void* item);
+
+// Replacing an element by one with the same or lower priority
+void pqIncreaseKey(PriorityQueue* pq, PQHandle handle, void* item);
+
+// Replacing an element by one with any priority
+void pqUpdate(PriorityQueue* pq, PQHandle handle, void* item);
+
+// Remove and return the element with a given handle
+void* pqRemove(PriorityQueue* pq, PQHandle handle);
+
+// Checking if queue is empty or not
+bool pqIsEmpty(PriorityQueue* pq);
+
+// Reserving the capacity for at least a given number of elements
+void pqReserve(PriorityQueue* pq, size_t capacity);
+
+// Clearing a given queue
+void pqClear(PriorityQueue* pq);
+
+// Deleting a given queue
+void pqDelete(PriorityQueue* pq);
+
+
+#endif // PRIORITY_QUEUE_H
@@ -1,6 +1,7 @@
 /* Insides of Singly Linked List data structure */
 
 #include "basic.h"
+#include "nodepool.h"
 
 #ifndef SINGLY_LINKED_LIST_H
 #define SINGLY_LINKED_LIST_H
@@ -18,13 +19,21 @@ typedef struct SLL_type {
     size_t size;
     Node* head;
     Node* tail;
+    // The nodes of the list are taken from this pool
+    NodePool pool;
 } List;
 
+// Comparator of two elements, less than 0 means that [a] stands before [b]
+typedef int (*ListCompare)(const void* a, const void* b, void* ctx);
+
+// Sorting function, see "include/list_sortings.h"
+typedef void (*ListSortFunc)(List* list, ListCompare cmp, void* ctx);
+
 
 // New list creation
 List* listNew();
 
-// New node creation
+// New node creation, the node is not owned by any list
 Node* nodeNew(void* value);
 
 // Creating a new list from a given array
@@ -114,11 +123,11 @@ void listExtend(List* f_list, List* s_list);
 // Swapping two lists
 void swapLists(List* f_list, List* s_list);
 
-// Sorting a given list 'in-place' by a chisen sort function
-void listSortMut(List* list, List*(*func)(List*));
+// Sorting a given list 'in-place' by a chosen sort function
+void listSortMut(List* list, ListSortFunc func, ListCompare cmp, void* ctx);
 
 // Creating a copy, sorting it by a chosen sort function and return
-List* listSortNew(List* list, List*(*func)(List*));
+List* listSortNew(List* list, ListSortFunc func, ListCompare cmp, void* ctx);
 
 // Clear list
 void listClear(List* list);
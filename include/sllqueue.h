@@ -1,6 +1,7 @@
 /* Insides of Queue data srtucture with base SSL */
 
 #include "basic.h"
+#include "nodepool.h"
 
 #ifndef SSL_QUEUE_H
 #define SSL_QUEUE_H
@@ -18,6 +19,8 @@ typedef struct Queue_type {
     size_t size;
     Node* front;
     Node* back;
+    // The nodes of the queue are taken from this pool
+    NodePool pool;
 } Queue;
 
 
@@ -27,7 +30,7 @@ typedef struct Queue_type {
 // New queue creation using a given array
  Queue* queueFromArr(void** array, int size);
 
-// New node creation
+// New node creation, the node is not owned by any queue
  Node* qnodeNew(void* value);
 
 // Appending an element to the end of queue
@@ -1,6 +1,7 @@
 /* Insides of Stack data structure with base Singly Linked List */
 
 #include "basic.h"
+#include "nodepool.h"
 
 #ifndef SLL_STACK_H
 #define SLL_STACK_H
@@ -13,11 +14,13 @@ typedef struct Node_type {
     struct Node_type* next;
 } Node;
 
-// Queue data structure, based on Linked List
+// Stack data structure, based on Linked List, the head is the top
 typedef struct Stack_type {
     size_t size;
     Node* head;
     Node* tail;
+    // The nodes of the stack are taken from this pool
+    NodePool pool;
 } Stack;
 
 
@@ -27,19 +30,19 @@ Stack* stackNew();
 // New stack creation using a given array
 Stack* stackFromArr(void** array, int size);
 
-// New node creation
+// New node creation, the node is not owned by any stack
 Node* snodeNew(void* value);
 
-// Appending an element to the end of stack
+// Pushing an element on the top of stack
 void stackPush(Stack* stack, void* value);
 
-// Remove and return first element of stack
+// Remove and return the top element of stack
 void* stackPop(Stack* stack);
 
-// Getting the first element of stack
+// Getting the top element of stack
 void* stackTop(Stack* stack);
 
-// Getting the last element of stack
+// Getting the bottom element of stack
 void* stackTail(Stack* stack);
 
 // Getting the size of stack
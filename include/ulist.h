@@ -0,0 +1,118 @@
+/* Insides of Unrolled Linked List data structure (a list of small arrays) */
+
+#include "basic.h"
+#include "nodepool.h"
+
+#ifndef UNROLLED_LINKED_LIST_H
+#define UNROLLED_LINKED_LIST_H
+
+// The number of elements of a node, so that a node takes exactly 128 bytes, i.e. two cache lines,
+// the pool of the list aligns every node to a cache line
+#define ULIST_NODE_ITEMS 14
+
+// Every node except the first and the last one keeps at least this number of elements
+#define ULIST_MIN_ITEMS (ULIST_NODE_ITEMS / 2)
+
+#define ulistSize(x) (x->size)
+
+// Node structure, keeps a few neighbour elements of the list
+typedef struct UNode_type {
+    struct UNode_type* next;
+    size_t count;
+    void* items[ULIST_NODE_ITEMS];
+} UNode;
+
+// Unrolled linked list structure, stores a pointer to linked nodes
+typedef struct ULL_type {
+    size_t size;
+    UNode* head;
+    UNode* tail;
+    // The nodes of the list are taken from this pool
+    NodePool pool;
+} UList;
+
+
+// New list creation
+UList* ulistNew();
+
+// Creating a new list from a given array
+UList* ulistFromArr(void** array, size_t size);
+
+// Appending an element to the end of the list
+void ulistPush(UList* list, void* value);
+
+// Appending an element to the beginning of the list
+void ulistPrepend(UList* list, void* value);
+
+// Inserting an element at the specific position
+void ulistInsert(UList* list, void* value, size_t index);
+
+// Remove last element of the list
+void ulistRemoveEnd(UList* list);
+
+// Remove the first element of the list
+void ulistRemoveBegin(UList* list);
+
+// Remove an element standing at the specific position
+void ulistRemoveAt(UList* list, size_t index);
+
+// Getting index of a given element
+size_t ulistGetIndex(UList* list, void* value);
+
+// Getting value standing on a specific position
+void* ulistGetAt(UList* list, size_t index);
+
+// Getting the first element of a given list
+void* ulistGetBegin(UList* list);
+
+// Getting the last element of a given list
+void* ulistGetEnd(UList* list);
+
+// Remove the last element from list and return it
+void* ulistPop(UList* list);
+
+// Remove the first element from list and return it
+void* ulistPoll(UList* list);
+
+// Getting the number of elements of the list with a given value
+size_t ulistCount(UList* list, void* value);
+
+// Check if list contains given element or not
+bool ulistContains(UList* list, void* value);
+
+// Replacing an element by index
+void ulistReplaceByIndex(UList* list, size_t index, void* value);
+
+// Removing all elements of a given list
+void ulistClear(UList* list);
+
+// Deleting a given list
+void ulistDelete(UList* list);
+
+//////////////////////////////////////
+
+
+// Wrapper for unrolled list type, walks the elements from the beginning
+typedef struct UListIter_type {
+    // A list that should be wrapped in
+    UList* list;
+
+    // The node and the position in it of the next element
+    UNode* node;
+    size_t curr_index;
+} UListIterator;
+
+// Iterator starting from the first element
+UListIterator* ulistIterNew(UList* list);
+
+// Check if a given iterator has next element
+bool ulistIterHasNext(UListIterator* iterator);
+
+// Getting the next element of iterator
+void* ulistIterNext(UListIterator* iterator);
+
+// Deleting a given iterator
+void ulistIterDelete(UListIterator* iterator);
+
+
+#endif // UNROLLED_LINKED_LIST_H
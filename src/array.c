@@ -35,6 +35,7 @@ A short description of all:
 */
 
 #include "../include/array.h"
+#include "../include/array_sortings.h"
 
 /*
 
@@ -323,7 +324,7 @@ void arrayRemoveLast(Array* array, void* value)
     } else if (!arrayContains(array, value)) {
         _VALUE_ERROR;
     } else {
-        size_t last_index;
+        size_t last_index = 0;
 
         for (int i = 0; i < array->size; i++) {
             if (array->buff[i] == value) {
@@ -855,18 +856,24 @@ void swapArrays(Array* f_arr, Array* s_arr)
 /*
 
 Sorting a given array in-place, i.e. the given array is mutable.
-> Complex time - depending on what kind of sorting algorithm is used here.
+> Complex time - depending on what kind of sorting algorithm is used here,
+O(n*log(n)) for the default introsort.
 
  Parameters [in]:
     -> [array], an array, which should be sorted
-    -> [func], a function, which should sort the given array
+    -> [func], a function, which should sort the given array, if it is NULL introsort is used
+    -> [cmp], a comparator of elements, if it is NULL the raw values are compared
+    -> [ctx], a pointer, which is passed to every call of [cmp]
 
  Parameters [out]:
     -> NULL
 */
-void arraySortMut(Array* array, void**(*func)(void**, int))
+void arraySortMut(Array* array, ArraySortFunc func, ArrayCompare cmp, void* ctx)
 {
-    func(array->buff, array->size);
+    if (!func) {
+        func = introSort;
+    }
+    func(array->buff, array->size, cmp, ctx);
 }
 
 /*
@@ -875,33 +882,67 @@ Sorting a given array and return a copy of this array.
 > Complex time - depending on what kind of sorting algorithm is used here.
 
  Parameters [in]:
-    -> [array], an array, which sould be sorted and a copy of which should be return
-    -> [func], a function, which should sort the given array
+    -> [array], an array, a copy of which should be sorted and returned, it stays untouched
+    -> [func], a function, which should sort the given array, if it is NULL introsort is used
+    -> [cmp], a comparator of elements, if it is NULL the raw values are compared
+    -> [ctx], a pointer, which is passed to every call of [cmp]
 
  Parameters [out]:
     -> [new_arr], a new array, which is a sorted copy of a given one
 
 */
-Array* arraySortNew(Array* array, void**(*func)(void**, int))
+Array* arraySortNew(Array* array, ArraySortFunc func, ArrayCompare cmp, void* ctx)
 {
-    arraySortMut(array, func);
-
-    // Creating new array
+    // Creating new array with its own buffer
     Array* new_arr = arrayNew();
-
-    /* If the capacity of array is bigger than the capacity of a new one,
-       we should expand it capacity */
-    while (array->capacity > new_arr->capacity) {
-        arrayExpandCapacity(new_arr);
-    }
-    new_arr->size = array->size;
     new_arr->exp_val = array->exp_val;
-    new_arr->buff = array->buff;
+    for (size_t i = 0; i < array->size; i++) {
+        arrayToEnd(new_arr, array->buff[i]);
+    }
+
+    arraySortMut(new_arr, func, cmp, ctx);
     return new_arr;
 }
 
 /*
 
+Sorting a given array in-place by integer keys of its elements.
+> Complex time - O(n).
+
+ Parameters [in]:
+    -> [array], an array, which should be sorted, elements with equal keys keep their order
+    -> [key], an extractor of the key of element, if it is NULL raw values are unsigned keys
+    -> [ctx], a pointer, which is passed to every call of [key]
+
+ Parameters [out]:
+    -> NULL
+*/
+void arrayRadixSort(Array* array, ArrayRadixKey key, void* ctx)
+{
+    radixSort(array->buff, array->size, key, ctx);
+}
+
+/*
+
+Sorting a given array in-place by several threads.
+> Complex time - O(n*log(n) / p) for p threads.
+
+ Parameters [in]:
+    -> [array], an array, which should be sorted
+    -> [cmp], a comparator of elements, it must be safe to call it from several threads at once
+    -> [ctx], a pointer, which is passed to every call of [cmp]
+    -> [nthreads], the number of threads, if it is 0 every online processor gets one
+
+ Parameters [out]:
+    -> NULL
+*/
+void arraySortParallel(Array* array, ArrayCompare cmp, void* ctx, size_t nthreads)
+{
+    parallelSort(array->buff, array->size, cmp, ctx, nthreads);
+}
+
+/*
+
 Expansion of the capacity when it is necessary.
 > Given array must not be empty.
 > Complex time - most likely O(n).
@@ -0,0 +1,1221 @@
+/*
+
+-> Sorting algorithms for Array data structure <-
+
+This software is free and can be used and modifyied by anyone
+under the terms of the GNU General Public License as
+published by the Free Software Foundation, either version 3
+of the License, or any later version.
+
+[Author] -> Stacey Kerr
+[Github] -> https://github.com/wiseStann
+
+
+ Every algorithm takes a buffer of elements, its size and a comparator
+ with a context pointer, which is passed to every comparison. If the
+ comparator is NULL, the raw values of elements are compared.
+
+ The default algorithm is introsort, i.e. quicksort, which finishes small
+ parts by insertion sort and falls back to heap sort when partitions go
+ bad too often, so it is O(n*log(n)) in the worst case. Its partitions
+ defeat patterns as pdqsort does: a partition that needed no swaps is
+ checked for being already sorted, and a strongly unbalanced one shuffles
+ a few elements before the next try.
+
+ Timsort is the stable one. It finds runs, which are already sorted, in
+ the input, extends short runs by binary insertion sort and merges them,
+ keeping the runs on a stack balanced. When one run wins many times in a
+ row, the merge gallops, i.e. finds by exponential search how far that
+ run wins and copies the whole part at once. So sorted input takes a
+ single pass, and input with long runs costs little more.
+
+ Integer elements are sorted faster by LSD radix sort, which does not
+ compare them at all: the keys are split into 8-bit digits, and the
+ elements are distributed by every digit, from the lowest to the highest,
+ between the buffer and one scratch buffer. The counts of all digits are
+ taken by a single pass in advance, so a digit, which is the same in all
+ keys, is seen before and skipped.
+
+ Big buffers are sorted by several threads with sample sort. Splitters
+ are chosen from a sorted sample of elements, every thread counts how
+ many elements of its chunk fall between every two splitters, and then
+ moves them to their buckets in a scratch buffer. Buckets do not overlap
+ in the order, so they are sorted independently and copied back, and no
+ merging is needed at the end.
+
+*/
+
+#include "../include/array_sortings.h"
+#include <pthread.h>
+#include <unistd.h>
+
+
+static int _arrayCompareRaw__(const void* a, const void* b, void* ctx)
+{
+    (void)ctx;
+    return (a > b) - (a < b);
+}
+
+static inline void _arraySwap__(void** a, void** b)
+{
+    void* temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+/*
+
+Bubble sort algorithm.
+> Complex time - O(n^2).
+
+ Parameters [in]:
+    -> [array], a buffer, which should be sorted
+    -> [size], the number of elements
+    -> [cmp], a comparator of elements, if it is NULL the raw values are compared
+    -> [ctx], a pointer, which is passed to every call of [cmp]
+
+ Parameters [out]:
+    -> NULL
+*/
+void bubbleSort(void** array, size_t size, ArrayCompare cmp, void* ctx)
+{
+    cmp = cmp ? cmp : _arrayCompareRaw__;
+
+    bool swapped = true;
+    while (swapped) {
+        swapped = false;
+        for (size_t i = 1; i < size; i++) {
+            if (cmp(array[i - 1], array[i], ctx) > 0) {
+                _arraySwap__(&array[i - 1], &array[i]);
+                swapped = true;
+            }
+        }
+    }
+}
+
+/*
+
+Selection sort algorithm.
+> Complex time - O(n^2).
+
+ Parameters [in]:
+    -> [array], a buffer, which should be sorted
+    -> [size], the number of elements
+    -> [cmp], a comparator of elements, if it is NULL the raw values are compared
+    -> [ctx], a pointer, which is passed to every call of [cmp]
+
+ Parameters [out]:
+    -> NULL
+*/
+void selectionSort(void** array, size_t size, ArrayCompare cmp, void* ctx)
+{
+    cmp = cmp ? cmp : _arrayCompareRaw__;
+
+    for (size_t i = 0; i + 1 < size; i++) {
+        size_t min_idx = i;
+        for (size_t j = i + 1; j < size; j++) {
+            if (cmp(array[j], array[min_idx], ctx) < 0) {
+                min_idx = j;
+            }
+        }
+        _arraySwap__(&array[min_idx], &array[i]);
+    }
+}
+
+/*
+
+Insertion sort algorithm.
+> Complex time - O(n^2), O(n) if the buffer is almost sorted.
+
+ Parameters [in]:
+    -> [array], a buffer, which should be sorted
+    -> [size], the number of elements
+    -> [cmp], a comparator of elements, if it is NULL the raw values are compared
+    -> [ctx], a pointer, which is passed to every call of [cmp]
+
+ Parameters [out]:
+    -> NULL
+*/
+void insertionSort(void** array, size_t size, ArrayCompare cmp, void* ctx)
+{
+    cmp = cmp ? cmp : _arrayCompareRaw__;
+
+    for (size_t i = 1; i < size; i++) {
+        void* key = array[i];
+        size_t j = i;
+        while (j > 0 && cmp(array[j - 1], key, ctx) > 0) {
+            array[j] = array[j - 1];
+            j--;
+        }
+        array[j] = key;
+    }
+}
+
+/*
+
+Moving an element down to its place in a max heap.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [array], a heap, the children of [i] stand at [2i + 1] and [2i + 2]
+    -> [size], the size of the heap
+    -> [index], the position of the element, which should be moved
+    -> [cmp], [ctx], a comparator of elements and its context
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _arraySiftDown__(void** array, size_t size, size_t index, ArrayCompare cmp, void* ctx)
+{
+    void* item = array[index];
+    size_t child;
+    while ((child = 2 * index + 1) < size) {
+        if (child + 1 < size && cmp(array[child], array[child + 1], ctx) < 0) {
+            child++;
+        }
+        if (cmp(item, array[child], ctx) >= 0) {
+            break;
+        }
+        array[index] = array[child];
+        index = child;
+    }
+    array[index] = item;
+}
+
+/*
+
+Heap sort algorithm.
+> Complex time - O(n*log(n)) in any case.
+
+ Parameters [in]:
+    -> [array], a buffer, which should be sorted
+    -> [size], the number of elements
+    -> [cmp], a comparator of elements, if it is NULL the raw values are compared
+    -> [ctx], a pointer, which is passed to every call of [cmp]
+
+ Parameters [out]:
+    -> NULL
+*/
+void heapSort(void** array, size_t size, ArrayCompare cmp, void* ctx)
+{
+    cmp = cmp ? cmp : _arrayCompareRaw__;
+
+    for (size_t i = size / 2; i > 0; i--) {
+        _arraySiftDown__(array, size, i - 1, cmp, ctx);
+    }
+    for (size_t end = size; end > 1; end--) {
+        _arraySwap__(&array[0], &array[end - 1]);
+        _arraySiftDown__(array, end - 1, 0, cmp, ctx);
+    }
+}
+
+/*
+
+Ordering three elements of a buffer.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [array], a buffer
+    -> [a], [b], [c], the positions of elements, which should be ordered
+    -> [cmp], [ctx], a comparator of elements and its context
+
+ Parameters [out]:
+    -> NULL
+*/
+static inline void _arraySort3__(void** array, size_t a, size_t b, size_t c, ArrayCompare cmp, void* ctx)
+{
+    if (cmp(array[b], array[a], ctx) < 0) {
+        _arraySwap__(&array[a], &array[b]);
+    }
+    if (cmp(array[c], array[b], ctx) < 0) {
+        _arraySwap__(&array[b], &array[c]);
+        if (cmp(array[b], array[a], ctx) < 0) {
+            _arraySwap__(&array[a], &array[b]);
+        }
+    }
+}
+
+/*
+
+Insertion sort, which gives up after a few moves.
+> Complex time - O(n).
+
+* It is tried on partitions, which needed no swaps, i.e. the input
+may be already sorted there *
+
+ Parameters [in]:
+    -> [array], a buffer, which should be sorted
+    -> [size], the number of elements
+    -> [cmp], [ctx], a comparator of elements and its context
+
+ Parameters [out]:
+    -> [bool], true if the buffer is sorted now
+
+*/
+static bool _arrayPartialInsertionSort__(void** array, size_t size, ArrayCompare cmp, void* ctx)
+{
+    size_t moves = 0;
+    for (size_t i = 1; i < size; i++) {
+        if (moves > 8) {
+            return false;
+        }
+
+        void* key = array[i];
+        size_t j = i;
+        while (j > 0 && cmp(array[j - 1], key, ctx) > 0) {
+            array[j] = array[j - 1];
+            j--;
+        }
+        array[j] = key;
+        moves += i - j;
+    }
+    return true;
+}
+
+/*
+
+Partition of a buffer around the median of a few elements.
+> Complex time - O(n).
+
+* The pivot is put at the beginning first. Both scans stop at the elements
+equal to the pivot, so many equal elements are split evenly *
+
+ Parameters [in]:
+    -> [array], a buffer, which should be partitioned, at least 3 elements
+    -> [size], the number of elements
+    -> [cmp], [ctx], a comparator of elements and its context
+    -> [swapped], a place, where it is written if the partition moved anything
+
+ Parameters [out]:
+    -> [pivot], the final position of the pivot; the elements before it are
+        not bigger and the elements after it are not less
+
+*/
+static size_t _arrayPartition__(void** array, size_t size, ArrayCompare cmp, void* ctx, bool* swapped)
+{
+    size_t middle = size / 2;
+    if (size > ARRAY_SORT_NINTHER_THRESHOLD) {
+        size_t step = size / 8;
+        _arraySort3__(array, 0, step, 2 * step, cmp, ctx);
+        _arraySort3__(array, middle - step, middle, middle + step, cmp, ctx);
+        _arraySort3__(array, size - 1 - 2 * step, size - 1 - step, size - 1, cmp, ctx);
+        _arraySort3__(array, step, middle, size - 1 - step, cmp, ctx);
+    } else {
+        _arraySort3__(array, 0, middle, size - 1, cmp, ctx);
+    }
+    _arraySwap__(&array[0], &array[middle]);
+
+    void* pivot = array[0];
+    size_t i = 0;
+    size_t j = size;
+    *swapped = false;
+    for (;;) {
+        while (++i < size && cmp(array[i], pivot, ctx) < 0);
+        // The pivot itself stops this scan at the beginning
+        while (cmp(pivot, array[--j], ctx) < 0);
+        if (i >= j) {
+            break;
+        }
+        _arraySwap__(&array[i], &array[j]);
+        *swapped = true;
+    }
+    _arraySwap__(&array[0], &array[j]);
+    return j;
+}
+
+/*
+
+Main loop of introsort.
+> Complex time - O(n*log(n)).
+
+* The smaller part is sorted by a recursive call and the bigger one by the
+loop, so the recursion is at most log(n) deep *
+
+ Parameters [in]:
+    -> [array], a buffer, which should be sorted
+    -> [size], the number of elements
+    -> [cmp], [ctx], a comparator of elements and its context
+    -> [bad_allowed], how many unbalanced partitions are allowed before heap sort
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _arrayIntroSort__(void** array, size_t size, ArrayCompare cmp, void* ctx, size_t bad_allowed)
+{
+    while (size > ARRAY_SORT_INSERTION_THRESHOLD) {
+        bool swapped;
+        size_t pivot = _arrayPartition__(array, size, cmp, ctx, &swapped);
+        size_t left = pivot;
+        size_t right = size - pivot - 1;
+
+        if (left < size / 8 || right < size / 8) {
+            if (--bad_allowed == 0) {
+                heapSort(array, size, cmp, ctx);
+                return;
+            }
+
+            // Breaking the pattern, which has led to a bad pivot
+            if (left >= ARRAY_SORT_INSERTION_THRESHOLD) {
+                _arraySwap__(&array[0], &array[left / 4]);
+                _arraySwap__(&array[pivot - 1], &array[pivot - left / 4]);
+            }
+            if (right >= ARRAY_SORT_INSERTION_THRESHOLD) {
+                _arraySwap__(&array[pivot + 1], &array[pivot + 1 + right / 4]);
+                _arraySwap__(&array[size - 1], &array[size - right / 4]);
+            }
+        } else if (!swapped &&
+                   _arrayPartialInsertionSort__(array, pivot, cmp, ctx) &&
+                   _arrayPartialInsertionSort__(array + pivot + 1, right, cmp, ctx)) {
+            return;
+        }
+
+        if (left < right) {
+            _arrayIntroSort__(array, left, cmp, ctx, bad_allowed);
+            array += pivot + 1;
+            size = right;
+        } else {
+            _arrayIntroSort__(array + pivot + 1, right, cmp, ctx, bad_allowed);
+            size = left;
+        }
+    }
+    insertionSort(array, size, cmp, ctx);
+}
+
+/*
+
+Introsort algorithm.
+> Complex time - O(n*log(n)) in the worst case, O(n) on sorted input.
+
+ Parameters [in]:
+    -> [array], a buffer, which should be sorted
+    -> [size], the number of elements
+    -> [cmp], a comparator of elements, if it is NULL the raw values are compared
+    -> [ctx], a pointer, which is passed to every call of [cmp]
+
+ Parameters [out]:
+    -> NULL
+*/
+void introSort(void** array, size_t size, ArrayCompare cmp, void* ctx)
+{
+    cmp = cmp ? cmp : _arrayCompareRaw__;
+
+    size_t log_size = 0;
+    while (size >> (log_size + 1)) {
+        log_size++;
+    }
+    _arrayIntroSort__(array, size, cmp, ctx, log_size + 1);
+}
+
+// Deepest run stack of timsort, enough for 2^64 elements
+#define ARRAY_TIMSORT_MAX_RUNS 85
+
+// State of one timsort
+typedef struct ArrayTimSort_type {
+    void** array;
+    ArrayCompare cmp;
+    void* ctx;
+    // Current threshold for galloping, it grows when galloping does not pay off
+    size_t min_gallop;
+    // Temporary storage for the smaller of two merged runs
+    void** temp;
+    // Stack of pending runs, where they start and how long they are
+    size_t run_base[ARRAY_TIMSORT_MAX_RUNS];
+    size_t run_size[ARRAY_TIMSORT_MAX_RUNS];
+    size_t runs;
+} ArrayTimSort;
+
+/*
+
+Searching how many elements of a sorted buffer stand before a given key.
+> Complex time - O(log(k)), where k is the distance between [hint] and the result.
+
+* The search goes from [hint] by growing steps and finishes by binary
+search, so results close to the hint are cheap *
+
+ Parameters [in]:
+    -> [key], a key, which is searched
+    -> [base], a sorted buffer
+    -> [size], the number of elements of buffer, not 0
+    -> [hint], a position, where the search starts
+    -> [right], if it is true elements equal to [key] stand before it, otherwise after it
+    -> [cmp], [ctx], a comparator of elements and its context
+
+ Parameters [out]:
+    -> [position], the number of elements, which stand before the key
+
+*/
+static size_t _arrayGallop__(void* key, void** base, size_t size, size_t hint, bool right, ArrayCompare cmp, void* ctx)
+{
+    #define BEFORE(x) (right ? cmp((x), key, ctx) <= 0 : cmp((x), key, ctx) < 0)
+
+    size_t low, high;
+    size_t offset = 1;
+    if (BEFORE(base[hint])) {
+        size_t last = hint;
+        while (offset < size - hint && BEFORE(base[hint + offset])) {
+            last = hint + offset;
+            offset = 2 * offset + 1;
+        }
+        low = last + 1;
+        high = offset < size - hint ? hint + offset : size;
+    } else {
+        size_t first = hint;
+        while (offset <= hint && !BEFORE(base[hint - offset])) {
+            first = hint - offset;
+            offset = 2 * offset + 1;
+        }
+        low = offset <= hint ? hint - offset + 1 : 0;
+        high = first;
+    }
+
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (BEFORE(base[middle])) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+
+    #undef BEFORE
+}
+
+/*
+
+Binary insertion sort of a buffer, which begins with a sorted part.
+> Complex time - O(n^2) moves, O(n*log(n)) comparisons.
+
+ Parameters [in]:
+    -> [array], a buffer, which should be sorted
+    -> [size], the number of elements
+    -> [sorted], how many elements at the beginning are already sorted, at least 1
+    -> [cmp], [ctx], a comparator of elements and its context
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _arrayBinaryInsertionSort__(void** array, size_t size, size_t sorted, ArrayCompare cmp, void* ctx)
+{
+    for (size_t i = sorted; i < size; i++) {
+        void* pivot = array[i];
+        size_t low = 0;
+        size_t high = i;
+        // Equal elements stay before the pivot, so the sort is stable
+        while (low < high) {
+            size_t middle = low + (high - low) / 2;
+            if (cmp(pivot, array[middle], ctx) < 0) {
+                high = middle;
+            } else {
+                low = middle + 1;
+            }
+        }
+        memmove(array + low + 1, array + low, (i - low) * sizeof(void*));
+        array[low] = pivot;
+    }
+}
+
+/*
+
+Finding the run, which starts at the beginning of a buffer.
+> Complex time - O(k), where k is the size of run.
+
+* A strictly descending run is reversed in place, so every run ends up
+ascending. Descending runs must be strict, otherwise equal elements
+would change their order *
+
+ Parameters [in]:
+    -> [array], a buffer, which is not empty
+    -> [size], the number of elements
+    -> [cmp], [ctx], a comparator of elements and its context
+
+ Parameters [out]:
+    -> [run], the size of run
+
+*/
+static size_t _arrayCountRun__(void** array, size_t size, ArrayCompare cmp, void* ctx)
+{
+    if (size == 1) {
+        return 1;
+    }
+
+    size_t run = 2;
+    if (cmp(array[1], array[0], ctx) < 0) {
+        while (run < size && cmp(array[run], array[run - 1], ctx) < 0) {
+            run++;
+        }
+        for (size_t i = 0, j = run - 1; i < j; i++, j--) {
+            _arraySwap__(&array[i], &array[j]);
+        }
+    } else {
+        while (run < size && cmp(array[run], array[run - 1], ctx) >= 0) {
+            run++;
+        }
+    }
+    return run;
+}
+
+/*
+
+Getting the least size of a run, which is not extended by insertion sort.
+> Complex time - O(log(n)).
+
+* The size is between half and all of [ARRAY_TIMSORT_MIN_MERGE], and the
+buffer splits into a power of two runs or a bit less, which merge evenly *
+
+ Parameters [in]:
+    -> [size], the number of elements of a buffer
+
+ Parameters [out]:
+    -> [min_run], the least size of a run
+
+*/
+static size_t _arrayMinRun__(size_t size)
+{
+    size_t rest = 0;
+    while (size >= ARRAY_TIMSORT_MIN_MERGE) {
+        rest |= size & 1;
+        size >>= 1;
+    }
+    return size + rest;
+}
+
+/*
+
+Merging two neighbour runs, when the left one is not longer.
+> Complex time - O(n).
+
+* The left run is moved to temporary storage and the merge fills the
+place from the beginning *
+
+ Parameters [in]:
+    -> [sort], a state of timsort
+    -> [left], the beginning of the left run, the right one goes right after it
+    -> [left_size], [right_size], the sizes of runs, both are not 0
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _arrayMergeLow__(ArrayTimSort* sort, size_t left, size_t left_size, size_t right_size)
+{
+    void** array = sort->array;
+    void** temp = sort->temp;
+    ArrayCompare cmp = sort->cmp;
+    void* ctx = sort->ctx;
+    memcpy(temp, array + left, left_size * sizeof(void*));
+
+    size_t i = 0;
+    size_t j = left + left_size;
+    size_t end = j + right_size;
+    size_t dest = left;
+    size_t min_gallop = sort->min_gallop;
+
+    while (i < left_size && j < end) {
+        size_t wins_left = 0;
+        size_t wins_right = 0;
+
+        // One element at a time, until one run wins too often
+        while (i < left_size && j < end) {
+            if (cmp(array[j], temp[i], ctx) < 0) {
+                array[dest++] = array[j++];
+                wins_left = 0;
+                if (++wins_right >= min_gallop) {
+                    break;
+                }
+            } else {
+                array[dest++] = temp[i++];
+                wins_right = 0;
+                if (++wins_left >= min_gallop) {
+                    break;
+                }
+            }
+        }
+
+        // Galloping, while it moves enough elements at once
+        while (i < left_size && j < end) {
+            wins_left = _arrayGallop__(array[j], temp + i, left_size - i, 0, true, cmp, ctx);
+            memcpy(array + dest, temp + i, wins_left * sizeof(void*));
+            dest += wins_left;
+            i += wins_left;
+            if (i == left_size) {
+                break;
+            }
+            array[dest++] = array[j++];
+            if (j == end) {
+                break;
+            }
+
+            wins_right = _arrayGallop__(temp[i], array + j, end - j, 0, false, cmp, ctx);
+            memmove(array + dest, array + j, wins_right * sizeof(void*));
+            dest += wins_right;
+            j += wins_right;
+            if (j == end) {
+                break;
+            }
+            array[dest++] = temp[i++];
+
+            if (min_gallop > 1) {
+                min_gallop--;
+            }
+            if (wins_left < ARRAY_TIMSORT_MIN_GALLOP && wins_right < ARRAY_TIMSORT_MIN_GALLOP) {
+                min_gallop += 2;
+                break;
+            }
+        }
+    }
+    sort->min_gallop = min_gallop;
+
+    // The rest of the right run is already in its place
+    memcpy(array + dest, temp + i, (left_size - i) * sizeof(void*));
+}
+
+/*
+
+Merging two neighbour runs, when the right one is shorter.
+> Complex time - O(n).
+
+* The right run is moved to temporary storage and the merge fills the
+place from the end *
+
+ Parameters [in]:
+    -> [sort], a state of timsort
+    -> [left], the beginning of the left run, the right one goes right after it
+    -> [left_size], [right_size], the sizes of runs, both are not 0
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _arrayMergeHigh__(ArrayTimSort* sort, size_t left, size_t left_size, size_t right_size)
+{
+    void** array = sort->array;
+    void** temp = sort->temp;
+    void** base = array + left;
+    ArrayCompare cmp = sort->cmp;
+    void* ctx = sort->ctx;
+    memcpy(temp, base + left_size, right_size * sizeof(void*));
+
+    // [rest_left] and [rest_right] elements of runs are not merged yet
+    size_t rest_left = left_size;
+    size_t rest_right = right_size;
+    size_t dest = left_size + right_size;
+    size_t min_gallop = sort->min_gallop;
+
+    while (rest_left && rest_right) {
+        size_t wins_left = 0;
+        size_t wins_right = 0;
+
+        while (rest_left && rest_right) {
+            if (cmp(temp[rest_right - 1], base[rest_left - 1], ctx) < 0) {
+                base[--dest] = base[--rest_left];
+                wins_right = 0;
+                if (++wins_left >= min_gallop) {
+                    break;
+                }
+            } else {
+                base[--dest] = temp[--rest_right];
+                wins_left = 0;
+                if (++wins_right >= min_gallop) {
+                    break;
+                }
+            }
+        }
+
+        while (rest_left && rest_right) {
+            wins_left = rest_left - _arrayGallop__(temp[rest_right - 1], base, rest_left, rest_left - 1, true, cmp, ctx);
+            dest -= wins_left;
+            rest_left -= wins_left;
+            memmove(base + dest, base + rest_left, wins_left * sizeof(void*));
+            if (!rest_left) {
+                break;
+            }
+            base[--dest] = temp[--rest_right];
+            if (!rest_right) {
+                break;
+            }
+
+            wins_right = rest_right - _arrayGallop__(base[rest_left - 1], temp, rest_right, rest_right - 1, false, cmp, ctx);
+            dest -= wins_right;
+            rest_right -= wins_right;
+            memcpy(base + dest, temp + rest_right, wins_right * sizeof(void*));
+            if (!rest_right) {
+                break;
+            }
+            base[--dest] = base[--rest_left];
+
+            if (min_gallop > 1) {
+                min_gallop--;
+            }
+            if (wins_left < ARRAY_TIMSORT_MIN_GALLOP && wins_right < ARRAY_TIMSORT_MIN_GALLOP) {
+                min_gallop += 2;
+                break;
+            }
+        }
+    }
+    sort->min_gallop = min_gallop;
+
+    // The rest of the left run is already in its place
+    memcpy(base + rest_left, temp, rest_right * sizeof(void*));
+}
+
+/*
+
+Merging the runs [index] and [index + 1] of the stack.
+> Complex time - O(n).
+
+* The elements of the left run, which are not bigger than the first one of
+the right run, and the elements of the right run, which are less than the
+last one of the left run, are already in their places and are not merged *
+
+ Parameters [in]:
+    -> [sort], a state of timsort
+    -> [index], the position of the left run on the stack
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _arrayMergeAt__(ArrayTimSort* sort, size_t index)
+{
+    size_t left = sort->run_base[index];
+    size_t left_size = sort->run_size[index];
+    size_t right = sort->run_base[index + 1];
+    size_t right_size = sort->run_size[index + 1];
+
+    sort->run_size[index] = left_size + right_size;
+    if (index + 3 == sort->runs) {
+        sort->run_base[index + 1] = sort->run_base[index + 2];
+        sort->run_size[index + 1] = sort->run_size[index + 2];
+    }
+    sort->runs--;
+
+    void** array = sort->array;
+    size_t skip = _arrayGallop__(array[right], array + left, left_size, 0, true, sort->cmp, sort->ctx);
+    left += skip;
+    left_size -= skip;
+    if (!left_size) {
+        return;
+    }
+    right_size = _arrayGallop__(array[right - 1], array + right, right_size, right_size - 1, false, sort->cmp, sort->ctx);
+    if (!right_size) {
+        return;
+    }
+
+    if (left_size <= right_size) {
+        _arrayMergeLow__(sort, left, left_size, right_size);
+    } else {
+        _arrayMergeHigh__(sort, left, left_size, right_size);
+    }
+}
+
+/*
+
+Merging the runs on the top of the stack, while their sizes are not balanced.
+> Complex time - O(n) for all merges of a single run.
+
+* Every run must be longer than the two above it together, and longer
+than the one above it. So the stack is O(log(n)) deep and merged runs
+are about the same size *
+
+ Parameters [in]:
+    -> [sort], a state of timsort
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _arrayMergeCollapse__(ArrayTimSort* sort)
+{
+    size_t* size = sort->run_size;
+    while (sort->runs > 1) {
+        size_t n = sort->runs - 2;
+        if ((n > 0 && size[n - 1] <= size[n] + size[n + 1]) ||
+            (n > 1 && size[n - 2] <= size[n - 1] + size[n])) {
+            if (size[n - 1] < size[n + 1]) {
+                n--;
+            }
+        } else if (size[n] > size[n + 1]) {
+            break;
+        }
+        _arrayMergeAt__(sort, n);
+    }
+}
+
+/*
+
+Timsort algorithm.
+> Complex time - O(n*log(n)) in the worst case, O(n) on sorted input.
+
+* Elements, which are equal, keep their order. Buffers shorter than
+[ARRAY_TIMSORT_MIN_MERGE] are sorted by binary insertion, others need a
+temporary storage for the half of them *
+
+ Parameters [in]:
+    -> [array], a buffer, which should be sorted
+    -> [size], the number of elements
+    -> [cmp], a comparator of elements, if it is NULL the raw values are compared
+    -> [ctx], a pointer, which is passed to every call of [cmp]
+
+ Parameters [out]:
+    -> NULL
+*/
+void timSort(void** array, size_t size, ArrayCompare cmp, void* ctx)
+{
+    cmp = cmp ? cmp : _arrayCompareRaw__;
+    if (size < 2) {
+        return;
+    }
+
+    if (size < ARRAY_TIMSORT_MIN_MERGE) {
+        size_t run = _arrayCountRun__(array, size, cmp, ctx);
+        _arrayBinaryInsertionSort__(array, size, run, cmp, ctx);
+        return;
+    }
+
+    ArrayTimSort sort;
+    sort.array = array;
+    sort.cmp = cmp;
+    sort.ctx = ctx;
+    sort.min_gallop = ARRAY_TIMSORT_MIN_GALLOP;
+    sort.temp = NULL;
+    sort.runs = 0;
+
+    size_t min_run = _arrayMinRun__(size);
+    size_t start = 0;
+    while (start < size) {
+        size_t rest = size - start;
+        size_t run = _arrayCountRun__(array + start, rest, cmp, ctx);
+        if (run < min_run) {
+            size_t forced = rest < min_run ? rest : min_run;
+            _arrayBinaryInsertionSort__(array + start, forced, run, cmp, ctx);
+            run = forced;
+        }
+
+        // The buffer is sorted already, so there is nothing to merge
+        if (run == size) {
+            return;
+        }
+        if (!sort.temp) {
+            sort.temp = (void**)malloc((size / 2 + 1) * sizeof(void*));
+            if (!sort.temp) {
+                _MEMORY_ALLOCATION_ERROR;
+                exit(1);
+            }
+        }
+
+        sort.run_base[sort.runs] = start;
+        sort.run_size[sort.runs] = run;
+        sort.runs++;
+        _arrayMergeCollapse__(&sort);
+        start += run;
+    }
+
+    while (sort.runs > 1) {
+        size_t n = sort.runs - 2;
+        if (n > 0 && sort.run_size[n - 1] < sort.run_size[n + 1]) {
+            n--;
+        }
+        _arrayMergeAt__(&sort, n);
+    }
+    free(sort.temp);
+}
+
+/*
+
+Default key of radix sort, the raw value of element.
+> Complex time - const.
+
+* Values are taken unsigned, so the order is the same as the one of the
+comparison sorts with a NULL comparator *
+
+*/
+static uint64_t _arrayRadixKeyRaw__(const void* value, void* ctx)
+{
+    (void)ctx;
+    return (uint64_t)(uintptr_t)value;
+}
+
+// Key extractor with its context, which is the context of a comparator of keys
+typedef struct ArrayRadixCtx_type {
+    ArrayRadixKey key;
+    void* ctx;
+} ArrayRadixCtx;
+
+static int _arrayCompareKeys__(const void* a, const void* b, void* ctx)
+{
+    ArrayRadixCtx* radix = (ArrayRadixCtx*)ctx;
+    uint64_t key_a = radix->key(a, radix->ctx);
+    uint64_t key_b = radix->key(b, radix->ctx);
+    return (key_a > key_b) - (key_a < key_b);
+}
+
+/*
+
+LSD radix sort algorithm.
+> Complex time - O(n), precisely O(n * d) where d <= 8 is the number of different digits.
+
+* Elements with equal keys keep their order. Small buffers are sorted by
+insertion sort, which compares the same keys and is stable as well *
+
+ Parameters [in]:
+    -> [array], a buffer, which should be sorted
+    -> [size], the number of elements
+    -> [key], an extractor of the key of element, if it is NULL raw values are unsigned keys
+    -> [ctx], a pointer, which is passed to every call of [key]
+
+ Parameters [out]:
+    -> NULL
+*/
+void radixSort(void** array, size_t size, ArrayRadixKey key, void* ctx)
+{
+    key = key ? key : _arrayRadixKeyRaw__;
+
+    if (size < ARRAY_RADIX_THRESHOLD) {
+        ArrayRadixCtx radix = { key, ctx };
+        insertionSort(array, size, _arrayCompareKeys__, &radix);
+        return;
+    }
+
+    // The counts of every digit of all keys are taken at once
+    size_t counts[ARRAY_RADIX_DIGITS][1 << ARRAY_RADIX_BITS] = { { 0 } };
+    const uint64_t mask = (1 << ARRAY_RADIX_BITS) - 1;
+    for (size_t i = 0; i < size; i++) {
+        uint64_t k = key(array[i], ctx);
+        for (size_t d = 0; d < ARRAY_RADIX_DIGITS; d++) {
+            counts[d][(k >> (d * ARRAY_RADIX_BITS)) & mask]++;
+        }
+    }
+    uint64_t first = key(array[0], ctx);
+
+    void** scratch = (void**)malloc(size * sizeof(void*));
+    if (!scratch) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+
+    void** from = array;
+    void** to = scratch;
+    for (size_t d = 0; d < ARRAY_RADIX_DIGITS; d++) {
+        size_t shift = d * ARRAY_RADIX_BITS;
+        size_t* count = counts[d];
+        // All keys have the same digit, so this pass would not move anything
+        if (count[(first >> shift) & mask] == size) {
+            continue;
+        }
+
+        size_t offset = 0;
+        for (size_t b = 0; b <= mask; b++) {
+            size_t c = count[b];
+            count[b] = offset;
+            offset += c;
+        }
+        for (size_t i = 0; i < size; i++) {
+            void* value = from[i];
+            to[count[(key(value, ctx) >> shift) & mask]++] = value;
+        }
+
+        void** temp = from;
+        from = to;
+        to = temp;
+    }
+
+    if (from != array) {
+        memcpy(array, from, size * sizeof(void*));
+    }
+    free(scratch);
+}
+
+// Shared state of one parallel sort
+typedef struct ArrayParallel_type {
+    void** array;
+    void** scratch;
+    size_t size;
+    ArrayCompare cmp;
+    void* ctx;
+    // The number of threads, which is the number of chunks and buckets too
+    size_t nthreads;
+    // [nthreads - 1] splitters, the bucket [b] holds elements not less than [splitters[b - 1]]
+    void** splitters;
+    // Row [t] holds the sizes of buckets in chunk [t], and later where chunk [t] writes to them
+    size_t* counts;
+    // Where every bucket starts, with the size of buffer at the end
+    size_t* bounds;
+} ArrayParallel;
+
+// Task of one thread in one phase of parallel sort
+typedef struct ArrayParallelTask_type {
+    ArrayParallel* sort;
+    size_t id;
+} ArrayParallelTask;
+
+static inline size_t _arrayBucketOf__(ArrayParallel* sort, void* value)
+{
+    size_t low = 0;
+    size_t high = sort->nthreads - 1;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (sort->cmp(value, sort->splitters[middle], sort->ctx) < 0) {
+            high = middle;
+        } else {
+            low = middle + 1;
+        }
+    }
+    return low;
+}
+
+static void* _arrayParallelCount__(void* arg)
+{
+    ArrayParallelTask* task = (ArrayParallelTask*)arg;
+    ArrayParallel* sort = task->sort;
+    size_t* counts = sort->counts + task->id * sort->nthreads;
+    size_t end = sort->size * (task->id + 1) / sort->nthreads;
+
+    for (size_t i = sort->size * task->id / sort->nthreads; i < end; i++) {
+        counts[_arrayBucketOf__(sort, sort->array[i])]++;
+    }
+    return NULL;
+}
+
+static void* _arrayParallelScatter__(void* arg)
+{
+    ArrayParallelTask* task = (ArrayParallelTask*)arg;
+    ArrayParallel* sort = task->sort;
+    size_t* offsets = sort->counts + task->id * sort->nthreads;
+    size_t end = sort->size * (task->id + 1) / sort->nthreads;
+
+    for (size_t i = sort->size * task->id / sort->nthreads; i < end; i++) {
+        void* value = sort->array[i];
+        sort->scratch[offsets[_arrayBucketOf__(sort, value)]++] = value;
+    }
+    return NULL;
+}
+
+static void* _arrayParallelSortBucket__(void* arg)
+{
+    ArrayParallelTask* task = (ArrayParallelTask*)arg;
+    ArrayParallel* sort = task->sort;
+    size_t begin = sort->bounds[task->id];
+    size_t size = sort->bounds[task->id + 1] - begin;
+
+    introSort(sort->scratch + begin, size, sort->cmp, sort->ctx);
+    memcpy(sort->array + begin, sort->scratch + begin, size * sizeof(void*));
+    return NULL;
+}
+
+/*
+
+Running one phase of parallel sort, a task per thread.
+> Complex time - the time of the longest task.
+
+* The first task is run by the calling thread. If a thread can not be
+created, its task is run by the calling thread too *
+
+ Parameters [in]:
+    -> [tasks], the tasks, one for every thread
+    -> [count], the number of tasks
+    -> [func], a function, which is run for every task
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _arrayParallelRun__(ArrayParallelTask* tasks, size_t count, void* (*func)(void*))
+{
+    pthread_t threads[ARRAY_PARALLEL_MAX_THREADS];
+    bool started[ARRAY_PARALLEL_MAX_THREADS];
+
+    for (size_t i = 1; i < count; i++) {
+        started[i] = !pthread_create(&threads[i], NULL, func, &tasks[i]);
+    }
+    func(&tasks[0]);
+    for (size_t i = 1; i < count; i++) {
+        if (started[i]) {
+            pthread_join(threads[i], NULL);
+        } else {
+            func(&tasks[i]);
+        }
+    }
+}
+
+/*
+
+Parallel sample sort algorithm.
+> Complex time - O(n*log(n) / p) for p threads, if the buckets come out even.
+
+* Small buffers and a single thread are sorted by introsort in the calling
+thread. Elements equal to a splitter all go to one bucket, so a lot of
+equal elements make that bucket bigger, but not the result wrong *
+
+ Parameters [in]:
+    -> [array], a buffer, which should be sorted
+    -> [size], the number of elements
+    -> [cmp], a comparator of elements, it must be safe to call it from several threads at once,
+        if it is NULL the raw values are compared
+    -> [ctx], a pointer, which is passed to every call of [cmp]
+    -> [nthreads], the number of threads, if it is 0 every online processor gets one
+
+ Parameters [out]:
+    -> NULL
+*/
+void parallelSort(void** array, size_t size, ArrayCompare cmp, void* ctx, size_t nthreads)
+{
+    cmp = cmp ? cmp : _arrayCompareRaw__;
+
+    if (!nthreads) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        nthreads = online > 0 ? (size_t)online : 1;
+    }
+    if (nthreads > ARRAY_PARALLEL_MAX_THREADS) {
+        nthreads = ARRAY_PARALLEL_MAX_THREADS;
+    }
+    if (nthreads < 2 || size < ARRAY_PARALLEL_THRESHOLD) {
+        introSort(array, size, cmp, ctx);
+        return;
+    }
+
+    ArrayParallel sort = { array, NULL, size, cmp, ctx, nthreads, NULL, NULL, NULL };
+    size_t samples = nthreads * ARRAY_PARALLEL_OVERSAMPLING;
+    void** sample = (void**)malloc(samples * sizeof(void*));
+    sort.scratch = (void**)malloc(size * sizeof(void*));
+    sort.splitters = (void**)malloc((nthreads - 1) * sizeof(void*));
+    sort.counts = (size_t*)calloc(nthreads * nthreads, sizeof(size_t));
+    sort.bounds = (size_t*)malloc((nthreads + 1) * sizeof(size_t));
+    ArrayParallelTask* tasks = (ArrayParallelTask*)malloc(nthreads * sizeof(ArrayParallelTask));
+    if (!sample || !sort.scratch || !sort.splitters || !sort.counts || !sort.bounds || !tasks) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+
+    // The sample is spread evenly over the buffer, so sorted parts of it give fair splitters too
+    for (size_t i = 0; i < samples; i++) {
+        sample[i] = array[size / samples * i + (i * 7919) % (size / samples)];
+    }
+    introSort(sample, samples, cmp, ctx);
+    for (size_t b = 1; b < nthreads; b++) {
+        sort.splitters[b - 1] = sample[b * ARRAY_PARALLEL_OVERSAMPLING];
+    }
+    free(sample);
+
+    for (size_t t = 0; t < nthreads; t++) {
+        tasks[t].sort = &sort;
+        tasks[t].id = t;
+    }
+    _arrayParallelRun__(tasks, nthreads, _arrayParallelCount__);
+
+    // Every chunk writes to a bucket after the chunks before it
+    size_t offset = 0;
+    for (size_t b = 0; b < nthreads; b++) {
+        sort.bounds[b] = offset;
+        for (size_t t = 0; t < nthreads; t++) {
+            size_t count = sort.counts[t * nthreads + b];
+            sort.counts[t * nthreads + b] = offset;
+            offset += count;
+        }
+    }
+    sort.bounds[nthreads] = size;
+
+    _arrayParallelRun__(tasks, nthreads, _arrayParallelScatter__);
+    _arrayParallelRun__(tasks, nthreads, _arrayParallelSortBucket__);
+
+    free(tasks);
+    free(sort.bounds);
+    free(sort.counts);
+    free(sort.splitters);
+    free(sort.scratch);
+}
@@ -1,6 +1,6 @@
 /*
 
--> Binary Search Tree collection <-
+-> Binary Search Tree collection (Base: red-black tree) <-
 
 This software is free and can be used and modifyied by anyone
 under the terms of the GNU Lesser General Public License as
@@ -18,13 +18,24 @@ typedef struct Node_type {
     void* data;
     struct Node_type* left;
     struct Node_type* right;
+    struct Node_type* parent;
+    size_t size;
+    uint8_t color;
 } Node;
 
 typedef struct Tree_type {
     size_t size;
     Node* root;
+    BSTCompare cmp;
+    NodePool pool;
 } BSTree;
 
+ The tree is kept balanced by the red-black rules: the root is black,
+ a red node has no red children, and every path from a node down to a
+ missing child passes the same number of black nodes. So the height is
+ never bigger than 2 * log2(n + 1). Every operation walks the tree by
+ loops over [parent] links, so nothing depends on the stack depth.
+
 
 -> Macroses <-
 
@@ -40,25 +51,19 @@ A short description of all:
 
 #include "../include/binsearchtree.h"
 
-/*
-    Features which will be appended soon:
-   - int* bstreeLevelorderTraversal(Node_t* root); 
-*/
-
-
 /*
 
 A new binary search tree creating.
 > Complex time - const.
 
  Parameters [in]:
-    -> NULL
+    -> [cmp], a comparator of values, if it is NULL the raw values are compared
 
  Parameters [out]:
     -> [new_tree], a new created binary search tree
 
 */
-BSTree* bstreeNew()
+BSTree* bstreeNew(BSTCompare cmp)
 {
     BSTree* new_tree = (BSTree*)malloc(sizeof(BSTree));
     if (!new_tree) {
@@ -69,19 +74,22 @@ BSTree* bstreeNew()
 
     new_tree->size = 0;
     new_tree->root = NULL;
+    new_tree->cmp = cmp;
+    poolInit(&new_tree->pool, sizeof(Node_t));
     return new_tree;
 }
 
 /*
 
 A new node creating.
+> The node is allocated by itself and does not belong to any tree.
 > Complex time - const.
 
  Parameters [in]:
     -> [value], a value which this node should keep
 
  Parameters [out]:
-    -> [new_node], a new created node
+    -> [new_node], a new created red node
 
 */
 Node_t* treeNodeNew(void* value)
@@ -96,67 +104,468 @@ Node_t* treeNodeNew(void* value)
     new_node->data = value;
     new_node->left = NULL;
     new_node->right = NULL;
+    new_node->parent = NULL;
+    new_node->size = 1;
+    new_node->color = BSTREE_RED;
 
     return new_node;
 }
 
 /*
 
-Insertion a new value in the tree.
+A new node creating from the pool of a given tree.
+> Complex time - const.
 
  Parameters [in]:
-    -> [tree], a tree, which should be appended
-    -> [value], a value, which should be inserted in the tree
+    -> [tree], a tree, which the node will belong to
+    -> [value], a value which this node should keep
+
+ Parameters [out]:
+    -> [new_node], a new created red node
+
+*/
+static Node_t* _bstreeNodeNew__(BSTree* tree, void* value)
+{
+    Node_t* new_node = (Node_t*)poolAlloc(&tree->pool);
+    new_node->data = value;
+    new_node->left = NULL;
+    new_node->right = NULL;
+    new_node->parent = NULL;
+    new_node->size = 1;
+    new_node->color = BSTREE_RED;
+    return new_node;
+}
+
+static inline int _bstreeCompare__(BSTree* tree, void* a, void* b)
+{
+    if (tree->cmp) {
+        return tree->cmp(a, b);
+    }
+    return (a > b) - (a < b);
+}
+
+static inline bool _bstreeIsRed__(Node_t* node)
+{
+    return node && node->color == BSTREE_RED;
+}
+
+static inline size_t _bstreeNodeSize__(Node_t* node)
+{
+    return node ? node->size : 0;
+}
+
+/*
+
+Freeing a node, which is already unlinked from the tree.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [tree], the tree of the node
+    -> [node], a node, which should be freed
 
  Parameters [out]:
     -> NULL
 */
-void bstreeAppend(BSTree* tree, void* value)
+static inline void _bstreeFreeNode__(BSTree* tree, Node_t* node)
 {
-    if (tree->size >= MAXSIZE) {
-        panic("in '%s': max size of nodes exceeded");
-        exit(1);
-    } if (!tree->root) {
-        tree->root = treeNodeNew(value);
+    poolFree(&tree->pool, node);
+}
+
+/*
+
+Putting a given node to the place of another one, as a child of its parent.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [tree], a tree, the nodes of which are replaced
+    -> [node], a node, which should be replaced
+    -> [child], a node, which should take its place, may be NULL
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _bstreeReplaceChild__(BSTree* tree, Node_t* node, Node_t* child)
+{
+    if (!node->parent) {
+        tree->root = child;
+    } else if (node == node->parent->left) {
+        node->parent->left = child;
     } else {
-        _bstreeAppendNewNode__(tree->root, value);
+        node->parent->right = child;
+    }
+    if (child) {
+        child->parent = node->parent;
     }
-    tree->size++;
 }
 
 /*
 
-Main function of insertion the node in the binary tree.
+Rotation of a node with its right child.
+* I.e. the right child takes the place of the node, and the
+node becomes its left child *
+> Complex time - const.
 
  Parameters [in]:
-    -> [rott], root of the tree, which should be appended
-    -> [value], a value, which should be appended in the tree
+    -> [tree], a tree, which should be rotated
+    -> [node], a node, which should go down
 
  Parameters [out]:
     -> NULL
 */
-extern void _bstreeAppendNewNode__(Node_t* root, void* value)
+static void _bstreeRotateLeft__(BSTree* tree, Node_t* node)
 {
-    if (value < root->data) {
-        if (!root->left) {
-            root->left = treeNodeNew(value);
+    Node_t* pivot = node->right;
+    node->right = pivot->left;
+    if (pivot->left) {
+        pivot->left->parent = node;
+    }
+    _bstreeReplaceChild__(tree, node, pivot);
+    pivot->left = node;
+    node->parent = pivot;
+
+    pivot->size = node->size;
+    node->size = 1 + _bstreeNodeSize__(node->left) + _bstreeNodeSize__(node->right);
+}
+
+/*
+
+Rotation of a node with its left child.
+* I.e. the left child takes the place of the node, and the
+node becomes its right child *
+> Complex time - const.
+
+ Parameters [in]:
+    -> [tree], a tree, which should be rotated
+    -> [node], a node, which should go down
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _bstreeRotateRight__(BSTree* tree, Node_t* node)
+{
+    Node_t* pivot = node->left;
+    node->left = pivot->right;
+    if (pivot->right) {
+        pivot->right->parent = node;
+    }
+    _bstreeReplaceChild__(tree, node, pivot);
+    pivot->right = node;
+    node->parent = pivot;
+
+    pivot->size = node->size;
+    node->size = 1 + _bstreeNodeSize__(node->left) + _bstreeNodeSize__(node->right);
+}
+
+/*
+
+Restoring the red-black rules after a red node was linked.
+> Complex time - O(log(n)), at most two rotations.
+
+ Parameters [in]:
+    -> [tree], a tree, which should be fixed
+    -> [node], a new linked node
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _bstreeInsertFixup__(BSTree* tree, Node_t* node)
+{
+    Node_t* parent;
+    while ((parent = node->parent) && parent->color == BSTREE_RED) {
+        // The parent is red, so it is not the root and the grandparent exists
+        Node_t* grand = parent->parent;
+
+        if (parent == grand->left) {
+            Node_t* uncle = grand->right;
+            if (_bstreeIsRed__(uncle)) {
+                parent->color = uncle->color = BSTREE_BLACK;
+                grand->color = BSTREE_RED;
+                node = grand;
+                continue;
+            }
+            if (node == parent->right) {
+                _bstreeRotateLeft__(tree, parent);
+                node = parent;
+                parent = node->parent;
+            }
+            parent->color = BSTREE_BLACK;
+            grand->color = BSTREE_RED;
+            _bstreeRotateRight__(tree, grand);
         } else {
-            _bstreeAppendNewNode__(root->left, value);
+            Node_t* uncle = grand->left;
+            if (_bstreeIsRed__(uncle)) {
+                parent->color = uncle->color = BSTREE_BLACK;
+                grand->color = BSTREE_RED;
+                node = grand;
+                continue;
+            }
+            if (node == parent->left) {
+                _bstreeRotateRight__(tree, parent);
+                node = parent;
+                parent = node->parent;
+            }
+            parent->color = BSTREE_BLACK;
+            grand->color = BSTREE_RED;
+            _bstreeRotateLeft__(tree, grand);
         }
-    } else if (value > root->data) {
-        if (!root->right) {
-            root->right = treeNodeNew(value);
+    }
+    tree->root->color = BSTREE_BLACK;
+}
+
+/*
+
+Restoring the red-black rules after a black node was unlinked.
+> Complex time - O(log(n)), at most three rotations.
+
+* [node] is the child which took the place of the unlinked node, it
+misses one black node on its paths; it may be NULL, so its parent is
+passed too *
+
+ Parameters [in]:
+    -> [tree], a tree, which should be fixed
+    -> [node], a node which lacks one black node
+    -> [parent], the parent of that node
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _bstreeDeleteFixup__(BSTree* tree, Node_t* node, Node_t* parent)
+{
+    while (node != tree->root && !_bstreeIsRed__(node)) {
+        // The sibling has at least one black node on its paths, so it exists
+        if (node == parent->left) {
+            Node_t* sibling = parent->right;
+            if (sibling->color == BSTREE_RED) {
+                sibling->color = BSTREE_BLACK;
+                parent->color = BSTREE_RED;
+                _bstreeRotateLeft__(tree, parent);
+                sibling = parent->right;
+            }
+            if (!_bstreeIsRed__(sibling->left) && !_bstreeIsRed__(sibling->right)) {
+                sibling->color = BSTREE_RED;
+                node = parent;
+                parent = node->parent;
+                continue;
+            }
+            if (!_bstreeIsRed__(sibling->right)) {
+                sibling->left->color = BSTREE_BLACK;
+                sibling->color = BSTREE_RED;
+                _bstreeRotateRight__(tree, sibling);
+                sibling = parent->right;
+            }
+            sibling->color = parent->color;
+            parent->color = BSTREE_BLACK;
+            sibling->right->color = BSTREE_BLACK;
+            _bstreeRotateLeft__(tree, parent);
         } else {
-            _bstreeAppendNewNode__(root->right, value);
+            Node_t* sibling = parent->left;
+            if (sibling->color == BSTREE_RED) {
+                sibling->color = BSTREE_BLACK;
+                parent->color = BSTREE_RED;
+                _bstreeRotateRight__(tree, parent);
+                sibling = parent->left;
+            }
+            if (!_bstreeIsRed__(sibling->left) && !_bstreeIsRed__(sibling->right)) {
+                sibling->color = BSTREE_RED;
+                node = parent;
+                parent = node->parent;
+                continue;
+            }
+            if (!_bstreeIsRed__(sibling->left)) {
+                sibling->right->color = BSTREE_BLACK;
+                sibling->color = BSTREE_RED;
+                _bstreeRotateLeft__(tree, sibling);
+                sibling = parent->left;
+            }
+            sibling->color = parent->color;
+            parent->color = BSTREE_BLACK;
+            sibling->left->color = BSTREE_BLACK;
+            _bstreeRotateRight__(tree, parent);
+        }
+        node = tree->root;
+    }
+    if (node) {
+        node->color = BSTREE_BLACK;
+    }
+}
+
+/*
+
+Searching the node with a given value.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [tree], a tree which should be searched
+    -> [value], a value, which should be searched in tree
+
+ Parameters [out]:
+    -> [node], the found node, or NULL if there is no such value
+
+*/
+static Node_t* _bstreeFindNode__(BSTree* tree, void* value)
+{
+    Node_t* node = tree->root;
+    while (node) {
+        int order = _bstreeCompare__(tree, value, node->data);
+        if (order == 0) {
+            return node;
+        }
+        node = order < 0 ? node->left : node->right;
+    }
+    return NULL;
+}
+
+/*
+
+Linking the nodes of a slab range into a perfectly balanced subtree.
+> Complex time - O(n), the recursion is only O(log(n)) deep.
+
+* The node of the middle value becomes the root of the range. The nodes
+below the last complete level are red, all others are black, so every
+path passes the same number of black nodes *
+
+ Parameters [in]:
+    -> [slab], the nodes standing in the sorted order of their values
+    -> [begin], [end], the range of nodes, which should be linked
+    -> [parent], the parent of the subtree
+    -> [depth], the depth of the subtree root
+    -> [red_depth], the depth of the first incomplete level
+
+ Parameters [out]:
+    -> [root], the root of the subtree, or NULL if the range is empty
+
+*/
+static Node_t* _bstreeLinkRange__(Node_t* slab, size_t begin, size_t end,
+                                  Node_t* parent, size_t depth, size_t red_depth)
+{
+    if (begin == end) {
+        return NULL;
+    }
+
+    size_t middle = begin + (end - begin) / 2;
+    Node_t* node = &slab[middle];
+    node->parent = parent;
+    node->size = end - begin;
+    node->color = depth >= red_depth ? BSTREE_RED : BSTREE_BLACK;
+    node->left = _bstreeLinkRange__(slab, begin, middle, node, depth + 1, red_depth);
+    node->right = _bstreeLinkRange__(slab, middle + 1, end, node, depth + 1, red_depth);
+    return node;
+}
+
+/*
+
+Building a balanced tree from a sorted array.
+> Complex time - O(n).
+
+* All nodes are taken from one slab in the sorted order, so neighbour
+values stand in neighbour memory. The slab belongs to the pool of the
+tree, so deleted nodes of it are reused by later insertions *
+
+ Parameters [in]:
+    -> [array], an array of values, sorted and without duplicates
+    -> [cmp], a comparator of values, if it is NULL the raw values are compared
+
+ Parameters [out]:
+    -> [tree], a new created tree, or NULL if the array is not sorted
+
+*/
+BSTree* bstreeFromSortedArray(Array* array, BSTCompare cmp)
+{
+    BSTree* tree = bstreeNew(cmp);
+    size_t count = array->size;
+    for (size_t i = 1; i < count; i++) {
+        if (_bstreeCompare__(tree, array->buff[i - 1], array->buff[i]) >= 0) {
+            panic("in '%s': given array is not sorted or has duplicates", __FUNCTION__);
+            free(tree);
+            return NULL;
+        }
+    }
+    if (!count) {
+        return tree;
+    }
+
+    Node_t* slab = (Node_t*)poolAllocBlock(&tree->pool, count);
+    for (size_t i = 0; i < count; i++) {
+        slab[i].data = array->buff[i];
+    }
+
+    // The number of complete levels, i.e. floor(log2(count + 1))
+    size_t red_depth = 0;
+    while (((size_t)2 << red_depth) - 1 <= count) {
+        red_depth++;
+    }
+
+    tree->size = count;
+    tree->root = _bstreeLinkRange__(slab, 0, count, NULL, 0, red_depth);
+    return tree;
+}
+
+/*
+
+Creating an array of all values of a tree in the sorted order.
+> Complex time - O(n).
+
+ Parameters [in]:
+    -> [tree], a tree, the values of which should be taken
+
+ Parameters [out]:
+    -> [array], a new created array
+
+*/
+Array* bstreeToArray(BSTree* tree)
+{
+    Array* array = arrayNew();
+    bstreeTraversalToArray(tree, BSTREE_INORDER, array);
+    return array;
+}
+
+/*
+
+Insertion a new value in the tree.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [tree], a tree, which should be appended
+    -> [value], a value, which should be inserted in the tree
+
+ Parameters [out]:
+    -> NULL
+*/
+void bstreeAppend(BSTree* tree, void* value)
+{
+    Node_t* parent = NULL;
+    Node_t* node = tree->root;
+    int order = 0;
+    while (node) {
+        order = _bstreeCompare__(tree, value, node->data);
+        if (order == 0) {
+            panic("in 'bstreeAppend': the value is already in the tree");
+            return;
         }
+        parent = node;
+        node = order < 0 ? node->left : node->right;
+    }
+
+    Node_t* new_node = _bstreeNodeNew__(tree, value);
+    new_node->parent = parent;
+    if (!parent) {
+        tree->root = new_node;
+    } else if (order < 0) {
+        parent->left = new_node;
     } else {
-        panic("in 'bstreeAppend': the value is already in the tree");
+        parent->right = new_node;
     }
+    for (node = parent; node; node = node->parent) {
+        node->size++;
+    }
+    _bstreeInsertFixup__(tree, new_node);
+    tree->size++;
 }
 
 /*
 
 Deleting of a given value from the tree.
+> Complex time - O(log(n)).
 
  Parameters [in]:
     -> [tree], a tree the value of which should be deleted
@@ -165,18 +574,47 @@ Deleting of a given value from the tree.
  Parameters [out]:
     -> NULL
 */
-void bstreeDelete(Node_t* root, void* value)
+void bstreeDelete(BSTree* tree, void* value)
 {
-    if (!root) {
+    if (!tree->root) {
         _EMPTY_TREE_ERROR;
-    } else {
+        return;
+    }
+
+    Node_t* node = _bstreeFindNode__(tree, value);
+    if (!node) {
+        _VALUE_ERROR;
+        return;
+    }
+
+    // A node with two children takes the value of its successor, which is unlinked instead
+    if (node->left && node->right) {
+        Node_t* successor = node->right;
+        while (successor->left) {
+            successor = successor->left;
+        }
+        node->data = successor->data;
+        node = successor;
+    }
 
+    Node_t* child = node->left ? node->left : node->right;
+    Node_t* parent = node->parent;
+    for (Node_t* ancestor = parent; ancestor; ancestor = ancestor->parent) {
+        ancestor->size--;
     }
+    _bstreeReplaceChild__(tree, node, child);
+    if (node->color == BSTREE_BLACK) {
+        _bstreeDeleteFixup__(tree, child, parent);
+    }
+
+    _bstreeFreeNode__(tree, node);
+    tree->size--;
 }
 
 /*
 
 Checking if a given tree contains a given value.
+> Complex time - O(log(n)).
 
  Parameters [in]:
     -> [tree], a tree the node of which should be seached
@@ -192,31 +630,418 @@ bool bstreeSearch(BSTree* tree, void* value)
         return false;
     }
     
-    return _bstreeSearch__(tree->root, value);
+    return _bstreeFindNode__(tree, value) != NULL;
 }
 
 /*
 
-Main function of searching a node with a given value.
+Finding the first node, the value of which is bigger than a given one.
+> Complex time - O(log(n)).
 
  Parameters [in]:
-    -> [root], a root of tree which should be searched
-    -> [value], a value, which should be searched in tree
+    -> [tree], a tree, which should be searched
+    -> [value], a value, which does not have to be in the tree
+    -> [inclusive], if the node with a value equal to a given one may be found too
 
  Parameters [out]:
-    -> [bool], the result of searching a node
+    -> [node], the found node, or NULL if all values are smaller
 
 */
-extern bool _bstreeSearch__(Node_t* root, void* value)
+static Node_t* _bstreeFirstAfter__(BSTree* tree, void* value, bool inclusive)
 {
-    if (root->data == value) {
-        return true;
-    } else if (value < root->data && root->left) {
-        return _bstreeSearch__(root->left, value);
-    } else if (value > root->data && root->right) {
-        return _bstreeSearch__(root->right, value);
+    Node_t* found = NULL;
+    Node_t* node = tree->root;
+    while (node) {
+        int order = _bstreeCompare__(tree, value, node->data);
+        if (order < 0 || (order == 0 && inclusive)) {
+            found = node;
+            node = node->left;
+        } else {
+            node = node->right;
+        }
     }
-    return false;
+    return found;
+}
+
+/*
+
+Finding the last node, the value of which is smaller than a given one.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [tree], a tree, which should be searched
+    -> [value], a value, which does not have to be in the tree
+    -> [inclusive], if the node with a value equal to a given one may be found too
+
+ Parameters [out]:
+    -> [node], the found node, or NULL if all values are bigger
+
+*/
+static Node_t* _bstreeLastBefore__(BSTree* tree, void* value, bool inclusive)
+{
+    Node_t* found = NULL;
+    Node_t* node = tree->root;
+    while (node) {
+        int order = _bstreeCompare__(tree, value, node->data);
+        if (order > 0 || (order == 0 && inclusive)) {
+            found = node;
+            node = node->right;
+        } else {
+            node = node->left;
+        }
+    }
+    return found;
+}
+
+static inline bool _bstreeFoundValue__(Node_t* node, void** result)
+{
+    if (node && result) {
+        *result = node->data;
+    }
+    return node != NULL;
+}
+
+/*
+
+Finding the first value, which is not less than a given one.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [tree], a tree, which should be searched
+    -> [value], a value, which does not have to be in the tree
+    -> [result], a place, where the found value should be written to, may be NULL
+
+ Parameters [out]:
+    -> [bool], false if all values are less than a given one
+
+*/
+bool bstreeLowerBound(BSTree* tree, void* value, void** result)
+{
+    return _bstreeFoundValue__(_bstreeFirstAfter__(tree, value, true), result);
+}
+
+/*
+
+Finding the first value, which is bigger than a given one.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [tree], a tree, which should be searched
+    -> [value], a value, which does not have to be in the tree
+    -> [result], a place, where the found value should be written to, may be NULL
+
+ Parameters [out]:
+    -> [bool], false if no value is bigger than a given one
+
+*/
+bool bstreeUpperBound(BSTree* tree, void* value, void** result)
+{
+    return _bstreeFoundValue__(_bstreeFirstAfter__(tree, value, false), result);
+}
+
+/*
+
+Finding the biggest value, which is not bigger than a given one.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [tree], a tree, which should be searched
+    -> [value], a value, which does not have to be in the tree
+    -> [result], a place, where the found value should be written to, may be NULL
+
+ Parameters [out]:
+    -> [bool], false if all values are bigger than a given one
+
+*/
+bool bstreeFloor(BSTree* tree, void* value, void** result)
+{
+    return _bstreeFoundValue__(_bstreeLastBefore__(tree, value, true), result);
+}
+
+/*
+
+Finding the smallest value, which is not less than a given one.
+* The values of the tree are unique, so it is the same as the lower bound *
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [tree], a tree, which should be searched
+    -> [value], a value, which does not have to be in the tree
+    -> [result], a place, where the found value should be written to, may be NULL
+
+ Parameters [out]:
+    -> [bool], false if all values are less than a given one
+
+*/
+bool bstreeCeiling(BSTree* tree, void* value, void** result)
+{
+    return bstreeLowerBound(tree, value, result);
+}
+
+/*
+
+Counting the values of a tree, which are less than a given one.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [tree], a tree, the values of which should be counted
+    -> [value], a value, which does not have to be in the tree
+    -> [inclusive], if the value equal to a given one should be counted too
+
+ Parameters [out]:
+    -> [count], the number of values standing before a given one
+
+*/
+static size_t _bstreeCountLess__(BSTree* tree, void* value, bool inclusive)
+{
+    size_t count = 0;
+    Node_t* node = tree->root;
+    while (node) {
+        int order = _bstreeCompare__(tree, value, node->data);
+        if (order > 0 || (order == 0 && inclusive)) {
+            count += _bstreeNodeSize__(node->left) + 1;
+            node = node->right;
+        } else {
+            node = node->left;
+        }
+    }
+    return count;
+}
+
+/*
+
+Getting the value, which stands at a given position in the sorted order.
+> Complex time - O(log(n)).
+
+* Every node knows the size of its subtree, so the descent
+skips the whole left subtree when the position is behind it *
+
+ Parameters [in]:
+    -> [tree], a tree, which should be searched
+    -> [index], the position of the value, starting from 0
+
+ Parameters [out]:
+    -> [value], the value with [index] smaller values in the tree
+
+*/
+void* bstreeSelect(BSTree* tree, size_t index)
+{
+    if (index >= tree->size) {
+        _INDEX_ERROR(index);
+        return NULL;
+    }
+
+    Node_t* node = tree->root;
+    for (;;) {
+        size_t left_size = _bstreeNodeSize__(node->left);
+        if (index < left_size) {
+            node = node->left;
+        } else if (index > left_size) {
+            index -= left_size + 1;
+            node = node->right;
+        } else {
+            return node->data;
+        }
+    }
+}
+
+/*
+
+Getting the position of a given value in the sorted order.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [tree], a tree, which should be searched
+    -> [value], a value, which does not have to be in the tree
+
+ Parameters [out]:
+    -> [rank], the number of values in the tree less than a given one
+
+*/
+size_t bstreeRank(BSTree* tree, void* value)
+{
+    return _bstreeCountLess__(tree, value, false);
+}
+
+/*
+
+Counting the values of a tree, which are within given bounds.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [tree], a tree, the values of which should be counted
+    -> [low], [high], the bounds, both of them are included
+
+ Parameters [out]:
+    -> [count], the number of values not less than [low] and not bigger than [high]
+
+*/
+size_t bstreeRangeCount(BSTree* tree, void* low, void* high)
+{
+    size_t below_high = _bstreeCountLess__(tree, high, true);
+    size_t below_low = _bstreeCountLess__(tree, low, false);
+    return below_high > below_low ? below_high - below_low : 0;
+}
+
+/*
+
+Finding the first node of a given subtree in postorder.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [node], the root of a subtree
+
+ Parameters [out]:
+    -> [node], the deepest leaf reached by going left whenever possible
+
+*/
+static Node_t* _bstreePostorderFirst__(Node_t* node)
+{
+    for (;;) {
+        if (node->left) {
+            node = node->left;
+        } else if (node->right) {
+            node = node->right;
+        } else {
+            return node;
+        }
+    }
+}
+
+/*
+
+Finding the next node of a given one in a given order.
+> Complex time - O(log(n)) in the worst case, const on average.
+
+* The tree is walked by [parent] links, so pre-, in- and postorder
+need no stack at all. Levelorder takes nodes from the queue of an
+iterator and puts their children there *
+
+ Parameters [in]:
+    -> [iterator], an iterator, which should be moved
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _bstreeIterAdvance__(BSTreeIterator* iterator)
+{
+    Node_t* node = iterator->next;
+    Node_t* parent;
+
+    switch (iterator->order) {
+    case BSTREE_PREORDER:
+        if (node->left || node->right) {
+            iterator->next = node->left ? node->left : node->right;
+            return;
+        }
+        // Going up until there is a right subtree, which is not visited yet
+        while ((parent = node->parent) && (node == parent->right || !parent->right)) {
+            node = parent;
+        }
+        iterator->next = parent ? parent->right : NULL;
+        return;
+
+    case BSTREE_INORDER:
+        if (node->right) {
+            node = node->right;
+            while (node->left) {
+                node = node->left;
+            }
+            iterator->next = node;
+            return;
+        }
+        while ((parent = node->parent) && node == parent->right) {
+            node = parent;
+        }
+        iterator->next = parent;
+        return;
+
+    case BSTREE_POSTORDER:
+        parent = node->parent;
+        if (parent && node == parent->left && parent->right) {
+            iterator->next = _bstreePostorderFirst__(parent->right);
+        } else {
+            iterator->next = parent;
+        }
+        return;
+
+    case BSTREE_LEVELORDER:
+        if (node->left) {
+            iterator->queue[iterator->queue_tail++] = node->left;
+        }
+        if (node->right) {
+            iterator->queue[iterator->queue_tail++] = node->right;
+        }
+        iterator->next = iterator->queue_head < iterator->queue_tail
+            ? iterator->queue[iterator->queue_head++] : NULL;
+        return;
+    }
+}
+
+/*
+
+Putting an iterator at the first node of a given order.
+> Complex time - O(log(n)), O(n) memory for levelorder.
+
+ Parameters [in]:
+    -> [iterator], an iterator, which should be started
+    -> [tree], a tree, which should be traversed
+    -> [order], the order of traversal
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _bstreeIterStart__(BSTreeIterator* iterator, BSTree* tree, BSTOrder order)
+{
+    iterator->tree = tree;
+    iterator->order = order;
+    iterator->next = tree->root;
+    iterator->queue = NULL;
+    iterator->queue_head = iterator->queue_tail = 0;
+    iterator->bounded = false;
+    if (!tree->root) {
+        return;
+    }
+
+    if (order == BSTREE_INORDER) {
+        while (iterator->next->left) {
+            iterator->next = iterator->next->left;
+        }
+    } else if (order == BSTREE_POSTORDER) {
+        iterator->next = _bstreePostorderFirst__(tree->root);
+    } else if (order == BSTREE_LEVELORDER) {
+        // Every node is put into the queue once, except the root
+        iterator->queue = (Node_t**)malloc(tree->size * sizeof(Node_t*));
+        if (!iterator->queue) {
+            _MEMORY_ALLOCATION_ERROR;
+            exit(1);
+        }
+    }
+}
+
+/*
+
+Calling a given function for every value of a tree in a given order.
+> Complex time - O(n).
+
+ Parameters [in]:
+    -> [tree], a tree, which should be traversed
+    -> [order], the order of traversal
+    -> [visit], a function, which is called for every value
+    -> [ctx], a pointer, which is passed to every call of [visit]
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _bstreeTraverse__(BSTree* tree, BSTOrder order, BSTVisit visit, void* ctx)
+{
+    BSTreeIterator iterator;
+    _bstreeIterStart__(&iterator, tree, order);
+    while (iterator.next) {
+        visit(iterator.next->data, ctx);
+        _bstreeIterAdvance__(&iterator);
+    }
+    free(iterator.queue);
 }
 
 /*
@@ -224,80 +1049,102 @@ extern bool _bstreeSearch__(Node_t* root, void* value)
 Preorder tree traverse.
 * I.e. firstly we check the root then left child and
  then right child of the tree *
+> Complex time - O(n), const memory.
 
  Parameters [in]:
-    -> [root], root of the tree that should be traversed
+    -> [tree], the tree that should be traversed
+    -> [visit], a function, which is called for every value
+    -> [ctx], a pointer, which is passed to every call of [visit]
 
  Parameters [out]:
-    -> [traversal], an array of nodes
-    
+    -> NULL
 */
-int* bstreePreorderTraversal(Node_t* root)
+void bstreePreorderTraversal(BSTree* tree, BSTVisit visit, void* ctx)
 {
-    static int index = 0;
-    static int traversal[MAXSIZE];
-    if (root) {
-        traversal[index] = toInteger(root->data);
-        index++;
-        bstreePreorderTraversal(root->left);
-        bstreePreorderTraversal(root->right);
-    }
-
-    return traversal;
+    _bstreeTraverse__(tree, BSTREE_PREORDER, visit, ctx);
 }
 
 /*
 
 Postorder tree traverse.
-* I.e. firstly we check left child then the root and
- then right child of the tree *
+* I.e. firstly we check left child then right child and
+ then the root of the tree *
+> Complex time - O(n), const memory.
 
  Parameters [in]:
-    -> [root], root of the tree that should be traversed
+    -> [tree], the tree that should be traversed
+    -> [visit], a function, which is called for every value
+    -> [ctx], a pointer, which is passed to every call of [visit]
 
  Parameters [out]:
-    -> [traversal], an array of nodes
-    
+    -> NULL
 */
-int* bstreePostorderTraversal(Node_t* root)
+void bstreePostorderTraversal(BSTree* tree, BSTVisit visit, void* ctx)
 {
-    static int index = 0;
-    static int traversal[MAXSIZE];
-    if (root) {
-        bstreePostorderTraversal(root->left);
-        bstreePostorderTraversal(root->right);
-        traversal[index] = toInteger(root->data);
-        index++;
-    }
-    
-    return traversal;
+    _bstreeTraverse__(tree, BSTREE_POSTORDER, visit, ctx);
 }
 
 /*
 
 Inorder tree traverse.
 * I.e. firstly we check left child then the root and
- then right child of the tree *
+ then right child of the tree, so the values come sorted *
+> Complex time - O(n), const memory.
 
  Parameters [in]:
-    -> [root], root of the tree that should be traversed
+    -> [tree], the tree that should be traversed
+    -> [visit], a function, which is called for every value
+    -> [ctx], a pointer, which is passed to every call of [visit]
 
  Parameters [out]:
-    -> [traversal], an array of nodes
+    -> NULL
+*/
+void bstreeInorderTraversal(BSTree* tree, BSTVisit visit, void* ctx)
+{
+    _bstreeTraverse__(tree, BSTREE_INORDER, visit, ctx);
+}
+
+/*
+
+Levelorder tree traverse.
+* I.e. the nodes are checked level by level from the root,
+ every level from left to right *
+> Complex time - O(n), O(n) memory for the queue.
+
+ Parameters [in]:
+    -> [tree], the tree that should be traversed
+    -> [visit], a function, which is called for every value
+    -> [ctx], a pointer, which is passed to every call of [visit]
 
+ Parameters [out]:
+    -> NULL
 */
-int* bstreeInorderTraversal(Node_t* root)
+void bstreeLevelorderTraversal(BSTree* tree, BSTVisit visit, void* ctx)
 {
-    static int index = 0;
-    static int traversal[MAXSIZE];
-    if (root) {
-        bstreeInorderTraversal(root->left);
-        traversal[index] = toInteger(root->data);
-        index++;
-        bstreeInorderTraversal(root->right);
-    }
+    _bstreeTraverse__(tree, BSTREE_LEVELORDER, visit, ctx);
+}
 
-    return traversal;
+static void _bstreeVisitToArray__(void* value, void* array)
+{
+    arrayToEnd((Array*)array, value);
+}
+
+/*
+
+Appending all values of a tree in a given order to the end of an array.
+> Complex time - O(n).
+
+ Parameters [in]:
+    -> [tree], the tree that should be traversed
+    -> [order], the order of traversal
+    -> [array], an array, the values should be appended to
+
+ Parameters [out]:
+    -> NULL
+*/
+void bstreeTraversalToArray(BSTree* tree, BSTOrder order, Array* array)
+{
+    _bstreeTraverse__(tree, order, _bstreeVisitToArray__, array);
 }
 
 /*
@@ -362,7 +1209,7 @@ int bstreeMaxDepth(Node_t* root)
     int left_height = bstreeMaxDepth(root->left);
     int right_height = bstreeMaxDepth(root->right);
 
-    int max_height = left_height ? (left_height > right_height) : right_height;
+    int max_height = left_height > right_height ? left_height : right_height;
     return 1 + max_height;
 }
 
@@ -387,19 +1234,150 @@ bool bstreeIsEmpty(BSTree* tree)
 
 /*
 
-Checking if a given tree has the size is MAXSIZE or not.
+Removing all nodes of a given tree.
+> Complex time - O(slabs), all nodes are freed together with the slabs of the pool.
+
+ Parameters [in]:
+    -> [tree], a tree, which should be cleared
+
+ Parameters [out]:
+    -> NULL
+*/
+void bstreeClear(BSTree* tree)
+{
+    poolRelease(&tree->pool);
+    tree->root = NULL;
+    tree->size = 0;
+}
+
+/*
+
+Clearing all memory that was allocated for the tree.
+> Complex time - O(n).
+
+ Parameters [in]:
+    -> [tree], a tree, which should be deleted
+
+ Parameters [out]:
+    -> NULL
+*/
+void bstreeFree(BSTree* tree)
+{
+    bstreeClear(tree);
+    free(tree);
+}
+
+/*
+
+Creating an iterator for a given tree.
+> Complex time - O(log(n)), O(n) memory for levelorder.
+
+* The iterator is valid until the tree is changed. Any number of
+iterators may walk the same tree at once *
+
+ Parameters [in]:
+    -> [tree], a tree, which should be wrapped in
+    -> [order], the order, in which the values are returned
+
+ Parameters [out]:
+    -> [iterator], a new created iterator
+
+*/
+BSTreeIterator* bstreeIterNew(BSTree* tree, BSTOrder order)
+{
+    BSTreeIterator* iterator = (BSTreeIterator*)malloc(sizeof(BSTreeIterator));
+    if (!iterator) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+
+    _bstreeIterStart__(iterator, tree, order);
+    return iterator;
+}
+
+/*
+
+Creating an iterator, which walks the values within given bounds in sorted order.
+> Complex time - O(log(n)), and const on average for every step.
+
+* The iterator starts at the lower bound of [low] and goes by inorder
+successors, so a range of k values costs O(log(n) + k) *
+
+ Parameters [in]:
+    -> [tree], a tree, which should be wrapped in
+    -> [low], [high], the bounds, both of them are included
+
+ Parameters [out]:
+    -> [iterator], a new created iterator
+
+*/
+BSTreeIterator* bstreeRangeIterNew(BSTree* tree, void* low, void* high)
+{
+    BSTreeIterator* iterator = bstreeIterNew(tree, BSTREE_INORDER);
+    iterator->next = _bstreeFirstAfter__(tree, low, true);
+    iterator->high = high;
+    iterator->bounded = true;
+    return iterator;
+}
+
+/*
+
+Checking if a given tree has the next value or not.
 > Complex time - const.
 
  Parameters [in]:
-    -> [tree], the tree the size of which should be checked
+    -> [iterator], an iterator, the next value of which we check
 
  Parameters [out]:
-    -> [bool], the result of checking if the tree is full
-    
+    -> [bool], the result of checking
+
 */
-bool bstreeIsFull(BSTree* tree)
+bool bstreeIterHasNext(BSTreeIterator* iterator)
 {
-    if (bstreeSize(tree) == MAXSIZE)
-        return true;
-    return false;
+    if (!iterator->next) {
+        return false;
+    } else if (iterator->bounded) {
+        return _bstreeCompare__(iterator->tree, iterator->next->data, iterator->high) <= 0;
+    }
+    return true;
+}
+
+/*
+
+Getting the next value of a wrapped in tree.
+> Complex time - const on average.
+
+ Parameters [in]:
+    -> [iterator], an iterator, the next value of which should be returned
+
+ Parameters [out]:
+    -> [next_el], the next value, or NULL if all values are passed
+
+*/
+void* bstreeIterNext(BSTreeIterator* iterator)
+{
+    if (!bstreeIterHasNext(iterator)) {
+        return NULL;
+    }
+
+    void* next_el = iterator->next->data;
+    _bstreeIterAdvance__(iterator);
+    return next_el;
+}
+
+/*
+
+Deleting a given iterator, the tree stays untouched.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [iterator], an iterator, which should be deleted
+
+ Parameters [out]:
+    -> NULL
+*/
+void bstreeIterDelete(BSTreeIterator* iterator)
+{
+    free(iterator->queue);
+    free(iterator);
 }
@@ -0,0 +1,833 @@
+/*
+
+-> B+ Tree collection (Base: nodes of four cache lines, linked leaves) <-
+
+This software is free and can be used and modifyied by anyone
+under the terms of the GNU General Public License as
+published by the Free Software Foundation, either version 3
+of the License, or any later version.
+
+[Author] -> Stacey Kerr
+[Github] -> https://github.com/wiseStann
+
+
+-> Structure <-
+
+typedef struct BPTNode_type {
+    uint32_t count;
+    bool leaf;
+    void* keys[BPT_NODE_KEYS];
+    union {
+        struct BPTNode_type* children[BPT_NODE_CHILDREN];
+        struct {
+            void* values[BPT_NODE_KEYS];
+            struct BPTNode_type* next;
+        };
+    };
+} BPTNode;
+
+typedef struct BPTree_type {
+    size_t size;
+    size_t height;
+    BPTNode* root;
+    BPTNode* first;
+    BPTCompare cmp;
+} BPTree;
+
+ All keys with their values are kept in the leaves, inner nodes keep only
+ separators. A node of 15 keys takes 256 bytes, so a search step touches
+ a few neighbour cache lines instead of one line per level of a binary
+ tree, and the tree of 50M keys is only 7-8 levels high. The position of
+ a key inside a node is counted without branches. All leaves stay on the
+ same level and are linked in order, so a range is scanned leaf by leaf.
+
+
+-> Macroses <-
+
+ Check Error macroses in "include/basic.h" header file.
+ -> [_MEMORY_ALLOCATION_ERROR], a macros for notification about memory allocation error
+ -> [_VALUE_ERROR], a macros for notification about value, which is not in container
+
+*/
+
+#include "../include/bplustree.h"
+
+
+/*
+
+Creating a new empty node.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [leaf], if the node should be a leaf or an inner node
+
+ Parameters [out]:
+    -> [node], a new created node
+
+*/
+static BPTNode* _bptNodeNew__(bool leaf)
+{
+    BPTNode* node = (BPTNode*)aligned_alloc(CACHE_LINE_SIZE, sizeof(BPTNode));
+    if (!node) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+
+    node->count = 0;
+    node->leaf = leaf;
+    if (leaf) {
+        node->next = NULL;
+    }
+    return node;
+}
+
+static void _bptFreeNode__(BPTNode* node)
+{
+    if (!node->leaf) {
+        for (size_t i = 0; i <= node->count; i++) {
+            _bptFreeNode__(node->children[i]);
+        }
+    }
+    free(node);
+}
+
+static inline int _bptCompare__(BPTree* tree, void* a, void* b)
+{
+    if (tree->cmp) {
+        return tree->cmp(a, b);
+    }
+    return (a > b) - (a < b);
+}
+
+/*
+
+Counting the keys of a node, which are less than a given key.
+> Complex time - O(BPT_NODE_KEYS) for raw keys, O(log(BPT_NODE_KEYS)) for a comparator.
+
+* Raw keys are compared all at once, the loop has no branches and a
+constant length, so the compiler unrolls and vectorizes it. With a user
+comparator the binary search only moves its base, without branches *
+
+ Parameters [in]:
+    -> [tree], the tree of the node
+    -> [node], a node, which should be searched
+    -> [key], a key, the position of which should be found
+    -> [inclusive], if the keys equal to a given one should be counted too
+
+ Parameters [out]:
+    -> [position], the number of keys, which stand before a given one
+
+*/
+static inline size_t _bptPosition__(BPTree* tree, BPTNode* node, void* key, bool inclusive)
+{
+    if (!tree->cmp) {
+        uintptr_t raw = (uintptr_t)key;
+        size_t position = 0;
+        for (size_t i = 0; i < BPT_NODE_KEYS; i++) {
+            uintptr_t current = (uintptr_t)node->keys[i];
+            position += (i < node->count) & ((current < raw) | (inclusive & (current == raw)));
+        }
+        return position;
+    }
+
+    size_t size = node->count;
+    if (!size) {
+        return 0;
+    }
+    size_t base = 0;
+    int bound = inclusive ? 1 : 0;
+    while (size > 1) {
+        size_t half = size / 2;
+        base = (tree->cmp(node->keys[base + half], key) < bound) ? base + half : base;
+        size -= half;
+    }
+    return base + (tree->cmp(node->keys[base], key) < bound);
+}
+
+/*
+
+Finding the leaf, which should contain a given key.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [tree], a tree which should be searched
+    -> [key], a key, which should be searched
+    -> [path], [slots], if they are not NULL the inner nodes and the children
+        taken from them are written there
+
+ Parameters [out]:
+    -> [leaf], the found leaf
+
+*/
+static BPTNode* _bptFindLeaf__(BPTree* tree, void* key, BPTNode** path, size_t* slots)
+{
+    BPTNode* node = tree->root;
+    for (size_t depth = 0; !node->leaf; depth++) {
+        size_t slot = _bptPosition__(tree, node, key, true);
+        if (path) {
+            path[depth] = node;
+            slots[depth] = slot;
+        }
+        node = node->children[slot];
+        __builtin_prefetch(node);
+        __builtin_prefetch((char*)node + CACHE_LINE_SIZE);
+    }
+    return node;
+}
+
+/*
+
+Inserting a key in a full leaf and splitting it in two halves.
+> Complex time - O(BPT_NODE_KEYS).
+
+ Parameters [in]:
+    -> [leaf], a full leaf
+    -> [position], the position of a new key
+    -> [key], [value], a new key and its value
+
+ Parameters [out]:
+    -> [right], the new leaf with the right half of keys
+
+*/
+static BPTNode* _bptSplitLeaf__(BPTNode* leaf, size_t position, void* key, void* value)
+{
+    void* keys[BPT_NODE_KEYS + 1];
+    void* values[BPT_NODE_KEYS + 1];
+    memcpy(keys, leaf->keys, position * sizeof(void*));
+    memcpy(values, leaf->values, position * sizeof(void*));
+    keys[position] = key;
+    values[position] = value;
+    memcpy(keys + position + 1, leaf->keys + position, (BPT_NODE_KEYS - position) * sizeof(void*));
+    memcpy(values + position + 1, leaf->values + position, (BPT_NODE_KEYS - position) * sizeof(void*));
+
+    BPTNode* right = _bptNodeNew__(true);
+    size_t left_count = (BPT_NODE_KEYS + 1) / 2;
+    leaf->count = left_count;
+    right->count = BPT_NODE_KEYS + 1 - left_count;
+    memcpy(leaf->keys, keys, left_count * sizeof(void*));
+    memcpy(leaf->values, values, left_count * sizeof(void*));
+    memcpy(right->keys, keys + left_count, right->count * sizeof(void*));
+    memcpy(right->values, values + left_count, right->count * sizeof(void*));
+
+    right->next = leaf->next;
+    leaf->next = right;
+    return right;
+}
+
+/*
+
+Inserting a separator in a full inner node and splitting it in two halves.
+> Complex time - O(BPT_NODE_KEYS).
+
+ Parameters [in]:
+    -> [node], a full inner node
+    -> [slot], the position of a new separator
+    -> [separator], a new separator, the middle key of the node is written there
+    -> [child], a new child, which should stand right after the separator
+
+ Parameters [out]:
+    -> [right], the new node with the right half of keys
+
+*/
+static BPTNode* _bptSplitInner__(BPTNode* node, size_t slot, void** separator, BPTNode* child)
+{
+    void* keys[BPT_NODE_KEYS + 1];
+    BPTNode* children[BPT_NODE_CHILDREN + 1];
+    memcpy(keys, node->keys, slot * sizeof(void*));
+    keys[slot] = *separator;
+    memcpy(keys + slot + 1, node->keys + slot, (BPT_NODE_KEYS - slot) * sizeof(void*));
+    memcpy(children, node->children, (slot + 1) * sizeof(BPTNode*));
+    children[slot + 1] = child;
+    memcpy(children + slot + 2, node->children + slot + 1, (BPT_NODE_KEYS - slot) * sizeof(BPTNode*));
+
+    // The middle key goes up, the halves get the keys around it
+    BPTNode* right = _bptNodeNew__(false);
+    size_t left_count = (BPT_NODE_KEYS + 1) / 2;
+    node->count = left_count;
+    right->count = BPT_NODE_KEYS - left_count;
+    *separator = keys[left_count];
+    memcpy(node->keys, keys, left_count * sizeof(void*));
+    memcpy(node->children, children, (left_count + 1) * sizeof(BPTNode*));
+    memcpy(right->keys, keys + left_count + 1, right->count * sizeof(void*));
+    memcpy(right->children, children + left_count + 1, (right->count + 1) * sizeof(BPTNode*));
+    return right;
+}
+
+/*
+
+Merging the child of a given node with its right neighbour.
+> Complex time - O(BPT_NODE_KEYS).
+
+ Parameters [in]:
+    -> [parent], an inner node, the children of which should be merged
+    -> [slot], the position of the left child
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _bptMerge__(BPTNode* parent, size_t slot)
+{
+    BPTNode* left = parent->children[slot];
+    BPTNode* right = parent->children[slot + 1];
+
+    if (left->leaf) {
+        memcpy(left->keys + left->count, right->keys, right->count * sizeof(void*));
+        memcpy(left->values + left->count, right->values, right->count * sizeof(void*));
+        left->count += right->count;
+        left->next = right->next;
+    } else {
+        left->keys[left->count] = parent->keys[slot];
+        memcpy(left->keys + left->count + 1, right->keys, right->count * sizeof(void*));
+        memcpy(left->children + left->count + 1, right->children, (right->count + 1) * sizeof(BPTNode*));
+        left->count += right->count + 1;
+    }
+
+    memmove(parent->keys + slot, parent->keys + slot + 1, (parent->count - slot - 1) * sizeof(void*));
+    memmove(parent->children + slot + 1, parent->children + slot + 2,
+            (parent->count - slot - 1) * sizeof(BPTNode*));
+    parent->count--;
+    free(right);
+}
+
+/*
+
+Moving the last key of the left neighbour to a given child.
+> Complex time - O(BPT_NODE_KEYS).
+
+ Parameters [in]:
+    -> [parent], an inner node
+    -> [slot], the position of the child, which lacks keys
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _bptBorrowLeft__(BPTNode* parent, size_t slot)
+{
+    BPTNode* node = parent->children[slot];
+    BPTNode* left = parent->children[slot - 1];
+
+    memmove(node->keys + 1, node->keys, node->count * sizeof(void*));
+    if (node->leaf) {
+        memmove(node->values + 1, node->values, node->count * sizeof(void*));
+        node->keys[0] = left->keys[left->count - 1];
+        node->values[0] = left->values[left->count - 1];
+        parent->keys[slot - 1] = node->keys[0];
+    } else {
+        memmove(node->children + 1, node->children, (node->count + 1) * sizeof(BPTNode*));
+        node->keys[0] = parent->keys[slot - 1];
+        node->children[0] = left->children[left->count];
+        parent->keys[slot - 1] = left->keys[left->count - 1];
+    }
+    node->count++;
+    left->count--;
+}
+
+/*
+
+Moving the first key of the right neighbour to a given child.
+> Complex time - O(BPT_NODE_KEYS).
+
+ Parameters [in]:
+    -> [parent], an inner node
+    -> [slot], the position of the child, which lacks keys
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _bptBorrowRight__(BPTNode* parent, size_t slot)
+{
+    BPTNode* node = parent->children[slot];
+    BPTNode* right = parent->children[slot + 1];
+
+    if (node->leaf) {
+        node->keys[node->count] = right->keys[0];
+        node->values[node->count] = right->values[0];
+        memmove(right->values, right->values + 1, (right->count - 1) * sizeof(void*));
+        memmove(right->keys, right->keys + 1, (right->count - 1) * sizeof(void*));
+        parent->keys[slot] = right->keys[0];
+    } else {
+        node->keys[node->count] = parent->keys[slot];
+        node->children[node->count + 1] = right->children[0];
+        parent->keys[slot] = right->keys[0];
+        memmove(right->keys, right->keys + 1, (right->count - 1) * sizeof(void*));
+        memmove(right->children, right->children + 1, right->count * sizeof(BPTNode*));
+    }
+    node->count++;
+    right->count--;
+}
+
+/*
+
+Creating a new B+ tree.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [cmp], a comparator of keys, if it is NULL the raw values are compared
+
+ Parameters [out]:
+    -> [tree], a new created tree
+
+*/
+BPTree* bptreeNew(BPTCompare cmp)
+{
+    BPTree* tree = (BPTree*)malloc(sizeof(BPTree));
+    if (!tree) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+
+    tree->size = 0;
+    tree->height = 1;
+    tree->root = tree->first = _bptNodeNew__(true);
+    tree->cmp = cmp;
+    return tree;
+}
+
+/*
+
+Building a tree from sorted keys.
+> Complex time - O(n).
+
+* The tree is built level by level from the bottom, the entries are spread
+evenly over the nodes of a level, so every node is at least half full *
+
+ Parameters [in]:
+    -> [keys], an array of keys, sorted and without duplicates
+    -> [values], an array of values of the same size, if it is NULL the keys are values too
+    -> [cmp], a comparator of keys, if it is NULL the raw values are compared
+
+ Parameters [out]:
+    -> [tree], a new created tree, or NULL if keys are not sorted
+
+*/
+BPTree* bptreeFromSortedArray(Array* keys, Array* values, BPTCompare cmp)
+{
+    if (values && values->size != keys->size) {
+        panic("in '%s': given arrays have different sizes", __FUNCTION__);
+        return NULL;
+    }
+
+    BPTree* tree = bptreeNew(cmp);
+    size_t count = keys->size;
+    for (size_t i = 1; i < count; i++) {
+        if (_bptCompare__(tree, keys->buff[i - 1], keys->buff[i]) >= 0) {
+            panic("in '%s': given keys are not sorted or not unique", __FUNCTION__);
+            bptreeDelete(tree);
+            return NULL;
+        }
+    }
+    if (!count) {
+        return tree;
+    }
+    free(tree->root);
+
+    // Nodes of the current level and the smallest keys of their subtrees
+    size_t level_count = (count + BPT_NODE_KEYS - 1) / BPT_NODE_KEYS;
+    BPTNode** level = (BPTNode**)malloc(level_count * sizeof(BPTNode*));
+    void** smallest = (void**)malloc(level_count * sizeof(void*));
+    if (!level || !smallest) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+
+    size_t taken = 0;
+    for (size_t i = 0; i < level_count; i++) {
+        BPTNode* leaf = _bptNodeNew__(true);
+        leaf->count = count / level_count + (i < count % level_count);
+        memcpy(leaf->keys, keys->buff + taken, leaf->count * sizeof(void*));
+        memcpy(leaf->values, (values ? values : keys)->buff + taken, leaf->count * sizeof(void*));
+        taken += leaf->count;
+
+        if (i) {
+            level[i - 1]->next = leaf;
+        } else {
+            tree->first = leaf;
+        }
+        level[i] = leaf;
+        smallest[i] = leaf->keys[0];
+    }
+
+    // The parents are written over the children, which are already taken
+    while (level_count > 1) {
+        size_t parents_count = (level_count + BPT_NODE_CHILDREN - 1) / BPT_NODE_CHILDREN;
+        taken = 0;
+        for (size_t i = 0; i < parents_count; i++) {
+            BPTNode* parent = _bptNodeNew__(false);
+            size_t children = level_count / parents_count + (i < level_count % parents_count);
+            parent->count = children - 1;
+            for (size_t j = 0; j < children; j++) {
+                parent->children[j] = level[taken + j];
+                if (j) {
+                    parent->keys[j - 1] = smallest[taken + j];
+                }
+            }
+            smallest[i] = smallest[taken];
+            level[i] = parent;
+            taken += children;
+        }
+        level_count = parents_count;
+        tree->height++;
+    }
+
+    tree->root = level[0];
+    tree->size = count;
+    free(level);
+    free(smallest);
+    return tree;
+}
+
+/*
+
+Inserting a key with a value in a given tree.
+> Complex time - O(log(n)).
+
+* If the key is already in the tree only its value is replaced *
+
+ Parameters [in]:
+    -> [tree], a tree, in which the key should be inserted
+    -> [key], a key, which should be inserted
+    -> [value], a value of a given key
+
+ Parameters [out]:
+    -> [bool], true if the key was not in the tree before
+
+*/
+bool bptreeInsert(BPTree* tree, void* key, void* value)
+{
+    BPTNode* path[BPT_MAX_HEIGHT];
+    size_t slots[BPT_MAX_HEIGHT];
+    BPTNode* leaf = _bptFindLeaf__(tree, key, path, slots);
+
+    size_t position = _bptPosition__(tree, leaf, key, false);
+    if (position < leaf->count && _bptCompare__(tree, leaf->keys[position], key) == 0) {
+        leaf->values[position] = value;
+        return false;
+    }
+    tree->size++;
+
+    if (leaf->count < BPT_NODE_KEYS) {
+        memmove(leaf->keys + position + 1, leaf->keys + position, (leaf->count - position) * sizeof(void*));
+        memmove(leaf->values + position + 1, leaf->values + position, (leaf->count - position) * sizeof(void*));
+        leaf->keys[position] = key;
+        leaf->values[position] = value;
+        leaf->count++;
+        return true;
+    }
+
+    // Splits go up while the parents are full
+    BPTNode* child = _bptSplitLeaf__(leaf, position, key, value);
+    void* separator = child->keys[0];
+    for (size_t depth = tree->height - 1; depth > 0; depth--) {
+        BPTNode* parent = path[depth - 1];
+        size_t slot = slots[depth - 1];
+        if (parent->count < BPT_NODE_KEYS) {
+            memmove(parent->keys + slot + 1, parent->keys + slot, (parent->count - slot) * sizeof(void*));
+            memmove(parent->children + slot + 2, parent->children + slot + 1,
+                    (parent->count - slot) * sizeof(BPTNode*));
+            parent->keys[slot] = separator;
+            parent->children[slot + 1] = child;
+            parent->count++;
+            return true;
+        }
+        child = _bptSplitInner__(parent, slot, &separator, child);
+    }
+
+    if (tree->height >= BPT_MAX_HEIGHT) {
+        panic("in '%s': max height of the tree exceeded", __FUNCTION__);
+        exit(1);
+    }
+    BPTNode* root = _bptNodeNew__(false);
+    root->count = 1;
+    root->keys[0] = separator;
+    root->children[0] = tree->root;
+    root->children[1] = child;
+    tree->root = root;
+    tree->height++;
+    return true;
+}
+
+/*
+
+Searching a value of a given key.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [tree], a tree, which should be searched
+    -> [key], a key, the value of which should be found
+    -> [value], a place, where the found value should be written to, may be NULL
+
+ Parameters [out]:
+    -> [bool], the result of searching a key
+
+*/
+bool bptreeFind(BPTree* tree, void* key, void** value)
+{
+    BPTNode* leaf = _bptFindLeaf__(tree, key, NULL, NULL);
+    size_t position = _bptPosition__(tree, leaf, key, false);
+    if (position == leaf->count || _bptCompare__(tree, leaf->keys[position], key) != 0) {
+        return false;
+    }
+
+    if (value) {
+        *value = leaf->values[position];
+    }
+    return true;
+}
+
+/*
+
+Checking if a given tree contains a given key.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [tree], a tree, which should be checked
+    -> [key], a key, which should be searched
+
+ Parameters [out]:
+    -> [bool], the result of searching a key
+
+*/
+bool bptreeContains(BPTree* tree, void* key)
+{
+    return bptreeFind(tree, key, NULL);
+}
+
+/*
+
+Remove a given key from a given tree.
+> Complex time - O(log(n)).
+
+* A node which becomes less than half full takes a key from a neighbour,
+or is merged with it if the neighbour is half full itself *
+
+ Parameters [in]:
+    -> [tree], a tree, from which the key should be removed
+    -> [key], a key, which should be removed
+
+ Parameters [out]:
+    -> [bool], false if there was no such key in the tree
+
+*/
+bool bptreeErase(BPTree* tree, void* key)
+{
+    BPTNode* path[BPT_MAX_HEIGHT];
+    size_t slots[BPT_MAX_HEIGHT];
+    BPTNode* node = _bptFindLeaf__(tree, key, path, slots);
+
+    size_t position = _bptPosition__(tree, node, key, false);
+    if (position == node->count || _bptCompare__(tree, node->keys[position], key) != 0) {
+        return false;
+    }
+
+    memmove(node->keys + position, node->keys + position + 1, (node->count - position - 1) * sizeof(void*));
+    memmove(node->values + position, node->values + position + 1, (node->count - position - 1) * sizeof(void*));
+    node->count--;
+    tree->size--;
+
+    for (size_t depth = tree->height - 1; depth > 0 && node->count < BPT_MIN_KEYS; depth--) {
+        BPTNode* parent = path[depth - 1];
+        size_t slot = slots[depth - 1];
+
+        if (slot > 0 && parent->children[slot - 1]->count > BPT_MIN_KEYS) {
+            _bptBorrowLeft__(parent, slot);
+        } else if (slot < parent->count && parent->children[slot + 1]->count > BPT_MIN_KEYS) {
+            _bptBorrowRight__(parent, slot);
+        } else if (slot > 0) {
+            _bptMerge__(parent, slot - 1);
+        } else {
+            _bptMerge__(parent, slot);
+        }
+        node = parent;
+    }
+
+    // The root without separators is replaced by its only child
+    if (!tree->root->leaf && tree->root->count == 0) {
+        BPTNode* root = tree->root;
+        tree->root = root->children[0];
+        tree->height--;
+        free(root);
+    }
+    return true;
+}
+
+/*
+
+Checking if a given tree is empty or not.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [tree], a tree, which should be checked
+
+ Parameters [out]:
+    -> [bool], the result of checking
+
+*/
+bool bptreeIsEmpty(BPTree* tree)
+{
+    return tree->size == 0;
+}
+
+/*
+
+Clearing a given tree.
+> Complex time - O(n).
+
+ Parameters [in]:
+    -> [tree], a tree, which should be cleared
+
+ Parameters [out]:
+    -> NULL
+*/
+void bptreeClear(BPTree* tree)
+{
+    _bptFreeNode__(tree->root);
+    tree->size = 0;
+    tree->height = 1;
+    tree->root = tree->first = _bptNodeNew__(true);
+}
+
+/*
+
+Clearing all memory that was allocated for the tree.
+> Complex time - O(n).
+
+ Parameters [in]:
+    -> [tree], a tree, which should be deleted
+
+ Parameters [out]:
+    -> NULL
+*/
+void bptreeDelete(BPTree* tree)
+{
+    _bptFreeNode__(tree->root);
+    free(tree);
+}
+
+/*
+
+Moving an iterator to the next leaf, if its leaf is passed.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [iterator], an iterator, which should be moved
+
+ Parameters [out]:
+    -> NULL
+*/
+static inline void _bptIterNormalize__(BPTreeIterator* iterator)
+{
+    if (iterator->curr_index == iterator->leaf->count && iterator->leaf->next) {
+        iterator->leaf = iterator->leaf->next;
+        iterator->curr_index = 0;
+    }
+}
+
+/*
+
+Creating an iterator for a given tree.
+> Complex time - const.
+
+* The iterator is valid until the tree is changed *
+
+ Parameters [in]:
+    -> [tree], a tree, which should be wrapped in
+
+ Parameters [out]:
+    -> [iterator], a new created iterator, standing at the smallest key
+
+*/
+BPTreeIterator* bptreeIterNew(BPTree* tree)
+{
+    BPTreeIterator* iterator = (BPTreeIterator*)malloc(sizeof(BPTreeIterator));
+    if (!iterator) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+
+    iterator->tree = tree;
+    iterator->leaf = tree->first;
+    iterator->curr_index = 0;
+    return iterator;
+}
+
+/*
+
+Moving an iterator to the first key, which is not less than a given one.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [iterator], an iterator, which should be moved
+    -> [key], a key, from which the scan should start
+
+ Parameters [out]:
+    -> NULL
+*/
+void bptreeIterSeek(BPTreeIterator* iterator, void* key)
+{
+    BPTree* tree = iterator->tree;
+    iterator->leaf = _bptFindLeaf__(tree, key, NULL, NULL);
+    iterator->curr_index = _bptPosition__(tree, iterator->leaf, key, false);
+    _bptIterNormalize__(iterator);
+}
+
+/*
+
+Checking if a given tree has the next key or not.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [iterator], an iterator, the next key of which we check
+
+ Parameters [out]:
+    -> [bool], the result of checking
+
+*/
+bool bptreeIterHasNext(BPTreeIterator* iterator)
+{
+    return iterator->curr_index < iterator->leaf->count;
+}
+
+/*
+
+Getting the next key of a wrapped in tree.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [iterator], an iterator, the next key of which should be returned
+    -> [value], a place, where the value of the key should be written to, may be NULL
+
+ Parameters [out]:
+    -> [key], the next key, or NULL if all keys are passed
+
+*/
+void* bptreeIterNext(BPTreeIterator* iterator, void** value)
+{
+    if (!bptreeIterHasNext(iterator)) {
+        return NULL;
+    }
+
+    BPTNode* leaf = iterator->leaf;
+    void* key = leaf->keys[iterator->curr_index];
+    if (value) {
+        *value = leaf->values[iterator->curr_index];
+    }
+    iterator->curr_index++;
+    _bptIterNormalize__(iterator);
+    return key;
+}
+
+/*
+
+Deleting a given iterator, the tree stays untouched.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [iterator], an iterator, which should be deleted
+
+ Parameters [out]:
+    -> NULL
+*/
+void bptreeIterDelete(BPTreeIterator* iterator)
+{
+    free(iterator);
+}
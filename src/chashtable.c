@@ -0,0 +1,916 @@
+/*
+
+-> Concurrent Hash Table collection (Base: chained buckets, lock-free reads) <-
+
+This software is free and can be used and modifyied by anyone
+under the terms of the GNU General Public License as
+published by the Free Software Foundation, either version 3
+of the License, or any later version.
+
+[Author] -> Stacey Kerr
+[Github] -> https://github.com/wiseStann
+
+
+-> Structure <-
+
+typedef struct CHTNode_type {
+    CHTRetired retired;
+    void* key;
+    size_t hash;
+    _Atomic(void*) value;
+    _Atomic(struct CHTNode_type*) next;
+} CHTNode;
+
+typedef struct CHTTable_type {
+    CHTRetired retired;
+    size_t capacity;
+    size_t mask;
+    _Atomic(CHTNode*)* buckets;
+    _Atomic(struct CHTTable_type*) next;
+    atomic_size_t transfer_index;
+    atomic_size_t transfer_done;
+} CHTTable;
+
+typedef struct ConcurrentHashTable_type {
+    _Atomic(CHTTable*) table;
+    HTHash hash;
+    HTEqual equal;
+    CHTStripe* stripes;
+} ConcurrentHashTable;
+
+ Every bucket is a chain of nodes. Readers walk the chains with atomic
+ loads only and never take a lock. Writers lock the stripe of a bucket
+ (CHT_STRIPES locks, chosen by the low bits of the bucket index), so
+ writers of different stripes never wait for each other. A new node is
+ published at the head of its chain, a removed node is unlinked without
+ changing its own [next], so a reader which stands on it can go on.
+
+ Removed nodes and old tables are not freed at once, but retired: they
+ are freed by epoch based reclamation when no thread, which could have
+ seen them, is inside an operation anymore. Every thread has a record
+ with the epoch it has entered; the global epoch moves on only when all
+ active threads have seen it, and memory retired in the epoch [e] is
+ freed when the global epoch reaches [e + 2].
+
+ When the table is too loaded, a twice bigger one is linked as [next].
+ Any writer, which meets the resize, takes a chunk of buckets and moves
+ them: the chain of a bucket is copied to the new table under the stripe
+ lock, and the bucket is replaced by the forwarding marker. Readers and
+ writers which meet the marker go to the next table. The thread which
+ moves the last chunk makes the new table current.
+
+
+-> Macroses <-
+
+ Check Error macroses in "include/basic.h" header file.
+ -> [_MEMORY_ALLOCATION_ERROR], a macros for notification about memory allocation error
+
+*/
+
+#include "../include/chashtable.h"
+
+// How many retired objects a thread collects before it tries to move the epoch on
+#define CHT_ADVANCE_PERIOD 64
+
+// Record of a thread for the epoch based reclamation
+typedef struct CHTThread_type {
+    // The entered epoch shifted by one bit, the low bit is set inside an operation
+    _Alignas(CACHE_LINE_SIZE) atomic_size_t state;
+    atomic_bool in_use;
+    // The last global epoch seen by the thread
+    size_t local_epoch;
+    size_t retired_count;
+    // Retired memory, waiting for the epoch of the same index modulo 3 to be safe
+    CHTRetired* limbo[3];
+    struct CHTThread_type* next;
+} CHTThread;
+
+// Retired memory left by an exited thread, it is safe when the global epoch reaches [epoch + 2]
+typedef struct CHTOrphan_type {
+    CHTRetired* list;
+    size_t epoch;
+    struct CHTOrphan_type* next;
+} CHTOrphan;
+
+static atomic_size_t _cht_epoch = 0;
+static _Atomic(CHTThread*) _cht_threads = NULL;
+static _Atomic(CHTOrphan*) _cht_orphans = NULL;
+static _Thread_local CHTThread* _cht_self = NULL;
+static pthread_key_t _cht_key;
+static pthread_once_t _cht_once = PTHREAD_ONCE_INIT;
+
+// The bucket marker meaning that the chain is moved to the next table
+static CHTNode _cht_forward;
+#define CHT_FORWARD (&_cht_forward)
+
+
+/*
+
+Freeing a list of retired memory.
+> Complex time - O(n).
+
+ Parameters [in]:
+    -> [list], the head of the list, it becomes empty
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _chtFreeRetired__(CHTRetired** list)
+{
+    CHTRetired* retired = *list;
+    while (retired) {
+        CHTRetired* next = retired->next;
+        retired->destroy(retired);
+        retired = next;
+    }
+    *list = NULL;
+}
+
+/*
+
+Pushing a batch of orphaned memory to the global list.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [orphan], a batch, which should be freed later
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _chtOrphanPush__(CHTOrphan* orphan)
+{
+    CHTOrphan* head = atomic_load_explicit(&_cht_orphans, memory_order_relaxed);
+    do {
+        orphan->next = head;
+    } while (!atomic_compare_exchange_weak_explicit(&_cht_orphans, &head, orphan,
+                 memory_order_release, memory_order_relaxed));
+}
+
+/*
+
+Freeing the orphaned memory, which no reader can see anymore.
+> Complex time - O(n) for n orphaned objects.
+
+* The whole list is taken at once, so threads collecting together never
+see the same batch; batches that are not safe yet are pushed back *
+
+ Parameters [in]:
+    -> NULL
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _chtCollectOrphans__(void)
+{
+    if (!atomic_load_explicit(&_cht_orphans, memory_order_relaxed)) {
+        return;
+    }
+
+    size_t epoch = atomic_load(&_cht_epoch);
+    CHTOrphan* orphan = atomic_exchange_explicit(&_cht_orphans, NULL, memory_order_acquire);
+    while (orphan) {
+        CHTOrphan* next = orphan->next;
+        if (orphan->epoch + 2 <= epoch) {
+            _chtFreeRetired__(&orphan->list);
+            free(orphan);
+        } else {
+            _chtOrphanPush__(orphan);
+        }
+        orphan = next;
+    }
+}
+
+/*
+
+Giving the record of an exited thread to the next new thread.
+> Complex time - O(n) for n retired objects of the thread.
+
+* The retired memory of the thread can't wait for the next owner of the
+record, which may never come, so it is handed to the global orphan list *
+
+ Parameters [in]:
+    -> [record], the record of the exited thread
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _chtThreadExit__(void* record)
+{
+    CHTThread* self = (CHTThread*)record;
+
+    // All three lists are joined, everything in them was retired in the current epoch or before
+    CHTRetired* list = NULL;
+    for (size_t i = 0; i < 3; i++) {
+        while (self->limbo[i]) {
+            CHTRetired* retired = self->limbo[i];
+            self->limbo[i] = retired->next;
+            retired->next = list;
+            list = retired;
+        }
+    }
+    self->retired_count = 0;
+
+    if (list) {
+        CHTOrphan* orphan = (CHTOrphan*)malloc(sizeof(CHTOrphan));
+        if (!orphan) {
+            _MEMORY_ALLOCATION_ERROR;
+            exit(1);
+        }
+        orphan->list = list;
+        orphan->epoch = atomic_load(&_cht_epoch);
+        _chtOrphanPush__(orphan);
+    }
+
+    atomic_store_explicit(&self->in_use, false, memory_order_release);
+}
+
+static void _chtCreateKey__(void)
+{
+    pthread_key_create(&_cht_key, _chtThreadExit__);
+}
+
+/*
+
+Getting the record of the calling thread, registering it on the first call.
+> Complex time - const, O(threads) on the first call.
+
+ Parameters [in]:
+    -> NULL
+
+ Parameters [out]:
+    -> [self], the record of the calling thread
+
+*/
+static CHTThread* _chtSelf__(void)
+{
+    if (_cht_self) {
+        return _cht_self;
+    }
+    pthread_once(&_cht_once, _chtCreateKey__);
+
+    // Trying to adopt a record of some exited thread first
+    CHTThread* record = atomic_load_explicit(&_cht_threads, memory_order_acquire);
+    for (; record; record = record->next) {
+        bool expected = false;
+        if (atomic_compare_exchange_strong(&record->in_use, &expected, true)) {
+            break;
+        }
+    }
+
+    if (!record) {
+        record = (CHTThread*)aligned_alloc(CACHE_LINE_SIZE, sizeof(CHTThread));
+        if (!record) {
+            _MEMORY_ALLOCATION_ERROR;
+            exit(1);
+        }
+        atomic_init(&record->state, 0);
+        atomic_init(&record->in_use, true);
+        record->local_epoch = atomic_load(&_cht_epoch);
+        record->retired_count = 0;
+        record->limbo[0] = record->limbo[1] = record->limbo[2] = NULL;
+
+        CHTThread* head = atomic_load_explicit(&_cht_threads, memory_order_relaxed);
+        do {
+            record->next = head;
+        } while (!atomic_compare_exchange_weak_explicit(&_cht_threads, &head, record,
+                     memory_order_release, memory_order_relaxed));
+    }
+
+    pthread_setspecific(_cht_key, record);
+    _cht_self = record;
+    return record;
+}
+
+/*
+
+Entering an operation, after that nothing the thread can see is freed.
+> Complex time - const.
+
+ Parameters [in]:
+    -> NULL
+
+ Parameters [out]:
+    -> [self], the record of the calling thread
+
+*/
+static CHTThread* _chtEnter__(void)
+{
+    CHTThread* self = _chtSelf__();
+
+    size_t epoch = atomic_load(&_cht_epoch);
+    for (;;) {
+        atomic_store(&self->state, (epoch << 1) | 1);
+        size_t again = atomic_load(&_cht_epoch);
+        if (again == epoch) {
+            break;
+        }
+        epoch = again;
+    }
+
+    // Every epoch seen for the first time makes the memory retired two epochs ago safe
+    for (size_t e = self->local_epoch + 1; e <= epoch && e <= self->local_epoch + 3; e++) {
+        _chtFreeRetired__(&self->limbo[(e + 1) % 3]);
+    }
+    self->local_epoch = epoch;
+    return self;
+}
+
+/*
+
+Leaving an operation.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [self], the record of the calling thread
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _chtLeave__(CHTThread* self)
+{
+    atomic_store_explicit(&self->state, self->local_epoch << 1, memory_order_release);
+}
+
+/*
+
+Moving the global epoch on, if all active threads have seen the current one.
+> Complex time - O(threads).
+
+ Parameters [in]:
+    -> NULL
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _chtTryAdvance__(void)
+{
+    size_t epoch = atomic_load(&_cht_epoch);
+
+    CHTThread* record = atomic_load_explicit(&_cht_threads, memory_order_acquire);
+    for (; record; record = record->next) {
+        size_t state = atomic_load(&record->state);
+        if ((state & 1) && (state >> 1) != epoch) {
+            return;
+        }
+    }
+    if (atomic_compare_exchange_strong(&_cht_epoch, &epoch, epoch + 1)) {
+        _chtCollectOrphans__();
+    }
+}
+
+/*
+
+Retiring memory, which has been unlinked but may still be seen by readers.
+> Must be called inside an operation.
+> Complex time - const, O(threads) sometimes.
+
+ Parameters [in]:
+    -> [self], the record of the calling thread
+    -> [retired], the memory, which should be freed later
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _chtRetire__(CHTThread* self, CHTRetired* retired)
+{
+    // The global epoch may be one ahead of the entered one, and readers of it may see the memory
+    CHTRetired** list = &self->limbo[atomic_load(&_cht_epoch) % 3];
+    retired->next = *list;
+    *list = retired;
+
+    if (++self->retired_count % CHT_ADVANCE_PERIOD == 0) {
+        _chtTryAdvance__();
+    }
+}
+
+static void _chtNodeDestroy__(CHTRetired* retired)
+{
+    free((CHTNode*)retired);
+}
+
+static void _chtTableDestroy__(CHTRetired* retired)
+{
+    CHTTable* table = (CHTTable*)retired;
+    free(table->buckets);
+    free(table);
+}
+
+/*
+
+Creating a new node.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [key], [hash], [value], the content of the node
+    -> [next], the node, which should follow the new one
+
+ Parameters [out]:
+    -> [node], a new created node
+
+*/
+static CHTNode* _chtNodeNew__(void* key, size_t hash, void* value, CHTNode* next)
+{
+    CHTNode* node = (CHTNode*)malloc(sizeof(CHTNode));
+    if (!node) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+
+    node->retired.destroy = _chtNodeDestroy__;
+    node->key = key;
+    node->hash = hash;
+    atomic_init(&node->value, value);
+    atomic_init(&node->next, next);
+    return node;
+}
+
+/*
+
+Creating a new table of buckets.
+> Complex time - O(n).
+
+ Parameters [in]:
+    -> [capacity], the number of buckets, a power of two
+
+ Parameters [out]:
+    -> [table], a new created table with empty buckets
+
+*/
+static CHTTable* _chtTableNew__(size_t capacity)
+{
+    CHTTable* table = (CHTTable*)malloc(sizeof(CHTTable));
+    if (!table) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+
+    table->buckets = malloc(capacity * sizeof(_Atomic(CHTNode*)));
+    if (!table->buckets) {
+        free(table);
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+    for (size_t i = 0; i < capacity; i++) {
+        atomic_init(&table->buckets[i], NULL);
+    }
+
+    table->retired.destroy = _chtTableDestroy__;
+    table->capacity = capacity;
+    table->mask = capacity - 1;
+    atomic_init(&table->next, NULL);
+    atomic_init(&table->transfer_index, 0);
+    atomic_init(&table->transfer_done, 0);
+    return table;
+}
+
+/*
+
+Hashing a key of a given table.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [cht], a table, the hash function of which should be used
+    -> [key], a key, which should be hashed
+
+ Parameters [out]:
+    -> [hash], the mixed hash of a given key
+
+*/
+static inline size_t _chtHash__(ConcurrentHashTable* cht, const void* key)
+{
+    uint64_t hash = cht->hash ? (uint64_t)cht->hash(key) : (uint64_t)(uintptr_t)key;
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    return (size_t)hash;
+}
+
+static inline bool _chtEqual__(ConcurrentHashTable* cht, const void* a, const void* b)
+{
+    if (cht->equal) {
+        return cht->equal(a, b);
+    }
+    return a == b;
+}
+
+static inline CHTStripe* _chtStripe__(ConcurrentHashTable* cht, size_t index)
+{
+    return &(cht->stripes[index & (CHT_STRIPES - 1)]);
+}
+
+/*
+
+Moving one bucket of a given table to the next one.
+> Complex time - O(chain).
+
+* The nodes are copied, because readers of the old table may still stand
+on them, and the copies split into two buckets of the twice bigger table.
+Nobody can write to these two buckets before the marker is published *
+
+ Parameters [in]:
+    -> [cht], a concurrent table, which is being resized
+    -> [self], the record of the calling thread
+    -> [table], [next], the old and the new tables of buckets
+    -> [index], the bucket, which should be moved
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _chtTransferBucket__(ConcurrentHashTable* cht, CHTThread* self,
+                                 CHTTable* table, CHTTable* next, size_t index)
+{
+    CHTStripe* stripe = _chtStripe__(cht, index);
+    pthread_mutex_lock(&stripe->lock);
+
+    CHTNode* head = atomic_load_explicit(&table->buckets[index], memory_order_relaxed);
+    CHTNode* low = NULL;
+    CHTNode* high = NULL;
+    for (CHTNode* node = head; node; node = atomic_load_explicit(&node->next, memory_order_relaxed)) {
+        void* value = atomic_load_explicit(&node->value, memory_order_relaxed);
+        if (node->hash & table->capacity) {
+            high = _chtNodeNew__(node->key, node->hash, value, high);
+        } else {
+            low = _chtNodeNew__(node->key, node->hash, value, low);
+        }
+    }
+
+    atomic_store_explicit(&next->buckets[index], low, memory_order_release);
+    atomic_store_explicit(&next->buckets[index + table->capacity], high, memory_order_release);
+    atomic_store_explicit(&table->buckets[index], CHT_FORWARD, memory_order_release);
+    pthread_mutex_unlock(&stripe->lock);
+
+    while (head) {
+        CHTNode* next_node = atomic_load_explicit(&head->next, memory_order_relaxed);
+        _chtRetire__(self, &head->retired);
+        head = next_node;
+    }
+}
+
+/*
+
+Helping to move a given table to the next one.
+> Complex time - O(chunk) for every taken chunk.
+
+* The thread takes chunks of buckets while there are free ones. The
+thread which finishes the last chunk makes the next table current *
+
+ Parameters [in]:
+    -> [cht], a concurrent table, which is being resized
+    -> [self], the record of the calling thread
+    -> [table], the table, which is being moved
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _chtHelpTransfer__(ConcurrentHashTable* cht, CHTThread* self, CHTTable* table)
+{
+    CHTTable* next = atomic_load_explicit(&table->next, memory_order_acquire);
+
+    for (;;) {
+        size_t start = atomic_fetch_add(&table->transfer_index, CHT_TRANSFER_CHUNK);
+        if (start >= table->capacity) {
+            return;
+        }
+
+        size_t end = start + CHT_TRANSFER_CHUNK;
+        end = end > table->capacity ? table->capacity : end;
+        for (size_t i = start; i < end; i++) {
+            _chtTransferBucket__(cht, self, table, next, i);
+        }
+
+        size_t done = atomic_fetch_add(&table->transfer_done, end - start) + (end - start);
+        if (done == table->capacity) {
+            atomic_store_explicit(&cht->table, next, memory_order_release);
+            _chtRetire__(self, &table->retired);
+            return;
+        }
+    }
+}
+
+/*
+
+Starting a resize of a given table if it is too loaded.
+> Complex time - const, or O(chunk) if the thread helps to move.
+
+* The load is estimated by the counter of one stripe only, so writers
+do not have to share any counter *
+
+ Parameters [in]:
+    -> [cht], a concurrent table
+    -> [self], the record of the calling thread
+    -> [table], the table, an element was inserted to
+    -> [stripe_count], the number of elements of the stripe of that element
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _chtMaybeGrow__(ConcurrentHashTable* cht, CHTThread* self, CHTTable* table, size_t stripe_count)
+{
+    // Only the current table may be resized, and only once
+    if (table != atomic_load_explicit(&cht->table, memory_order_acquire) ||
+        atomic_load_explicit(&table->next, memory_order_acquire) != NULL) {
+        return;
+    } else if (stripe_count * CHT_STRIPES <= table->capacity / 4 * 3) {
+        return;
+    } else if (table->capacity >= CHT_MAX_CAPACITY) {
+        return;
+    }
+
+    CHTTable* next = _chtTableNew__(table->capacity * 2);
+    CHTTable* expected = NULL;
+    if (!atomic_compare_exchange_strong(&table->next, &expected, next)) {
+        // Somebody has already started the resize, nobody has seen our table
+        _chtTableDestroy__(&next->retired);
+    }
+    _chtHelpTransfer__(cht, self, table);
+}
+
+/*
+
+Creating a new concurrent hash table.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [hash], a hash function of keys, if it is NULL raw keys are hashed
+    -> [equal], an equality function of keys, if it is NULL raw keys are compared
+
+ Parameters [out]:
+    -> [cht], a new created table
+
+*/
+ConcurrentHashTable* chtNew(HTHash hash, HTEqual equal)
+{
+    ConcurrentHashTable* cht = (ConcurrentHashTable*)malloc(sizeof(ConcurrentHashTable));
+    if (!cht) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+
+    cht->stripes = (CHTStripe*)aligned_alloc(CACHE_LINE_SIZE, CHT_STRIPES * sizeof(CHTStripe));
+    if (!cht->stripes) {
+        free(cht);
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+    for (size_t i = 0; i < CHT_STRIPES; i++) {
+        pthread_mutex_init(&cht->stripes[i].lock, NULL);
+        atomic_init(&cht->stripes[i].count, 0);
+    }
+
+    cht->hash = hash;
+    cht->equal = equal;
+    atomic_init(&cht->table, _chtTableNew__(CHT_STANDARD_CAPACITY));
+    return cht;
+}
+
+/*
+
+Inserting a key with a value in a given table.
+> Complex time - const on average.
+
+* If the key is already in the table only its value is replaced *
+
+ Parameters [in]:
+    -> [cht], a table, in which the key should be inserted
+    -> [key], a key, which should be inserted
+    -> [value], a value of a given key
+
+ Parameters [out]:
+    -> [bool], true if the key was not in the table before
+
+*/
+bool chtInsert(ConcurrentHashTable* cht, void* key, void* value)
+{
+    CHTThread* self = _chtEnter__();
+    size_t hash = _chtHash__(cht, key);
+    CHTTable* table = atomic_load_explicit(&cht->table, memory_order_acquire);
+    bool inserted = false;
+    size_t stripe_count = 0;
+
+    for (;;) {
+        size_t index = hash & table->mask;
+        CHTStripe* stripe = _chtStripe__(cht, index);
+        pthread_mutex_lock(&stripe->lock);
+
+        CHTNode* head = atomic_load_explicit(&table->buckets[index], memory_order_relaxed);
+        if (head == CHT_FORWARD) {
+            pthread_mutex_unlock(&stripe->lock);
+            CHTTable* next = atomic_load_explicit(&table->next, memory_order_acquire);
+            _chtHelpTransfer__(cht, self, table);
+            table = next;
+            continue;
+        }
+
+        CHTNode* node = head;
+        while (node && !(node->hash == hash && _chtEqual__(cht, node->key, key))) {
+            node = atomic_load_explicit(&node->next, memory_order_relaxed);
+        }
+
+        if (node) {
+            atomic_store_explicit(&node->value, value, memory_order_release);
+        } else {
+            node = _chtNodeNew__(key, hash, value, head);
+            atomic_store_explicit(&table->buckets[index], node, memory_order_release);
+            stripe_count = atomic_fetch_add_explicit(&stripe->count, 1, memory_order_relaxed) + 1;
+            inserted = true;
+        }
+        pthread_mutex_unlock(&stripe->lock);
+        break;
+    }
+
+    if (inserted) {
+        _chtMaybeGrow__(cht, self, table, stripe_count);
+    }
+    _chtLeave__(self);
+    return inserted;
+}
+
+/*
+
+Searching a value of a given key.
+> Never takes a lock.
+> Complex time - const on average.
+
+ Parameters [in]:
+    -> [cht], a table, which should be searched
+    -> [key], a key, the value of which should be found
+    -> [value], a place, where the found value should be written to, may be NULL
+
+ Parameters [out]:
+    -> [bool], the result of searching a key
+
+*/
+bool chtFind(ConcurrentHashTable* cht, void* key, void** value)
+{
+    CHTThread* self = _chtEnter__();
+    size_t hash = _chtHash__(cht, key);
+    CHTTable* table = atomic_load_explicit(&cht->table, memory_order_acquire);
+
+    CHTNode* node = atomic_load_explicit(&table->buckets[hash & table->mask], memory_order_acquire);
+    while (node == CHT_FORWARD) {
+        table = atomic_load_explicit(&table->next, memory_order_acquire);
+        node = atomic_load_explicit(&table->buckets[hash & table->mask], memory_order_acquire);
+    }
+
+    while (node && !(node->hash == hash && _chtEqual__(cht, node->key, key))) {
+        node = atomic_load_explicit(&node->next, memory_order_acquire);
+    }
+
+    if (node && value) {
+        *value = atomic_load_explicit(&node->value, memory_order_acquire);
+    }
+    _chtLeave__(self);
+    return node != NULL;
+}
+
+/*
+
+Checking if a given table contains a given key.
+> Never takes a lock.
+> Complex time - const on average.
+
+ Parameters [in]:
+    -> [cht], a table, which should be checked
+    -> [key], a key, which should be searched
+
+ Parameters [out]:
+    -> [bool], the result of searching a key
+
+*/
+bool chtContains(ConcurrentHashTable* cht, void* key)
+{
+    return chtFind(cht, key, NULL);
+}
+
+/*
+
+Remove a given key from a given table.
+> Complex time - const on average.
+
+ Parameters [in]:
+    -> [cht], a table, from which the key should be removed
+    -> [key], a key, which should be removed
+
+ Parameters [out]:
+    -> [bool], false if there was no such key in the table
+
+*/
+bool chtErase(ConcurrentHashTable* cht, void* key)
+{
+    CHTThread* self = _chtEnter__();
+    size_t hash = _chtHash__(cht, key);
+    CHTTable* table = atomic_load_explicit(&cht->table, memory_order_acquire);
+    CHTNode* removed = NULL;
+
+    for (;;) {
+        size_t index = hash & table->mask;
+        CHTStripe* stripe = _chtStripe__(cht, index);
+        pthread_mutex_lock(&stripe->lock);
+
+        if (atomic_load_explicit(&table->buckets[index], memory_order_relaxed) == CHT_FORWARD) {
+            pthread_mutex_unlock(&stripe->lock);
+            CHTTable* next = atomic_load_explicit(&table->next, memory_order_acquire);
+            _chtHelpTransfer__(cht, self, table);
+            table = next;
+            continue;
+        }
+
+        _Atomic(CHTNode*)* link = &table->buckets[index];
+        CHTNode* node;
+        while ((node = atomic_load_explicit(link, memory_order_relaxed))) {
+            if (node->hash == hash && _chtEqual__(cht, node->key, key)) {
+                // The node keeps its [next], so a reader standing on it can go on
+                CHTNode* next_node = atomic_load_explicit(&node->next, memory_order_relaxed);
+                atomic_store_explicit(link, next_node, memory_order_release);
+                atomic_fetch_sub_explicit(&stripe->count, 1, memory_order_relaxed);
+                removed = node;
+                break;
+            }
+            link = &node->next;
+        }
+        pthread_mutex_unlock(&stripe->lock);
+        break;
+    }
+
+    if (removed) {
+        _chtRetire__(self, &removed->retired);
+    }
+    _chtLeave__(self);
+    return removed != NULL;
+}
+
+/*
+
+Getting the number of elements of a given table.
+> Complex time - O(CHT_STRIPES).
+
+* If other threads are working at the same time, the result is
+just a snapshot, which may be already outdated *
+
+ Parameters [in]:
+    -> [cht], a table, the size of which should be returned
+
+ Parameters [out]:
+    -> [size], the number of elements
+
+*/
+size_t chtSize(ConcurrentHashTable* cht)
+{
+    size_t size = 0;
+    for (size_t i = 0; i < CHT_STRIPES; i++) {
+        size += atomic_load_explicit(&cht->stripes[i].count, memory_order_relaxed);
+    }
+    return size;
+}
+
+/*
+
+Clearing all memory that was allocated for the table.
+> No thread may use the table after that.
+> Complex time - O(n).
+
+* Memory retired before is freed now if no other thread is inside an
+operation, otherwise by later operations *
+
+ Parameters [in]:
+    -> [cht], a table, which should be deleted
+
+ Parameters [out]:
+    -> NULL
+*/
+void chtDelete(ConcurrentHashTable* cht)
+{
+    // Finishing a resize in progress, so only one table is left
+    CHTThread* self = _chtEnter__();
+    CHTTable* table = atomic_load(&cht->table);
+    while (atomic_load(&table->next)) {
+        _chtHelpTransfer__(cht, self, table);
+        table = atomic_load(&cht->table);
+    }
+    _chtLeave__(self);
+
+    /* Usually nobody works with tables at this moment, so the epoch can be moved
+     * on twice, and the memory retired by this thread and by exited threads is
+     * freed now instead of waiting for some later operation
+     */
+    for (size_t i = 0; i < 2; i++) {
+        _chtTryAdvance__();
+    }
+    _chtLeave__(_chtEnter__());
+
+    for (size_t i = 0; i < table->capacity; i++) {
+        CHTNode* node = atomic_load_explicit(&table->buckets[i], memory_order_relaxed);
+        while (node) {
+            CHTNode* next = atomic_load_explicit(&node->next, memory_order_relaxed);
+            free(node);
+            node = next;
+        }
+    }
+    _chtTableDestroy__(&table->retired);
+
+    for (size_t i = 0; i < CHT_STRIPES; i++) {
+        pthread_mutex_destroy(&cht->stripes[i].lock);
+    }
+    free(cht->stripes);
+    free(cht);
+}
@@ -1 +1,318 @@
+/*
 
+-> Circular Queue collection (Base: Ring Buffer, lock-free SPSC) <-
+
+This software is free and can be used and modifyied by anyone
+under the terms of the GNU General Public License as
+published by the Free Software Foundation, either version 3
+of the License, or any later version.
+
+[Author] -> Stacey Kerr
+[Github] -> https://github.com/wiseStann
+
+
+-> Structure <-
+
+typedef struct CircularQueue_type {
+    atomic_size_t tail;
+    size_t cached_head;
+
+    atomic_size_t head;
+    size_t cached_tail;
+
+    size_t capacity;
+    size_t mask;
+    void **buff;
+} CircularQueue;
+
+ The queue has a fixed capacity and is intended to be used by exactly one
+ producer thread and exactly one consumer thread at the same time.
+ [head] and [tail] are free running counters, the slot of a counter is
+ found by masking it with [mask], so the capacity is a power of two.
+ Every side owns its own index and keeps a cached copy of the index of
+ the other side, which is reloaded only when the queue looks full (or
+ empty), so in the common case a side touches only its own cache lines.
+
+
+-> Macroses <-
+
+ Check Error macroses in "include/basic.h" header file.
+ -> [_MEMORY_ALLOCATION_ERROR], a macros for notification about memory allocation error
+
+*/
+
+#include "../include/circularqueue.h"
+
+
+/*
+
+Creating a new circular queue.
+> Complex time - const.
+
+* A given capacity is rounded up to the next power of two *
+
+ Parameters [in]:
+    -> [capacity], the minimum number of elements the queue should keep
+
+ Parameters [out]:
+    -> [queue], a new created queue
+
+*/
+CircularQueue* cqueueNew(size_t capacity)
+{
+    if (capacity == 0 || capacity > CQUEUE_MAX_CAPACITY) {
+        panic("in '%s': capacity %zu is not supported", __FUNCTION__, capacity);
+        exit(1);
+    }
+
+    size_t real_cap = 1;
+    while (real_cap < capacity) {
+        real_cap <<= 1;
+    }
+
+    // aligned_alloc wants the size to be a multiple of the alignment
+    size_t struct_size = (sizeof(CircularQueue) + CACHE_LINE_SIZE - 1) & ~((size_t)CACHE_LINE_SIZE - 1);
+    CircularQueue* queue = (CircularQueue*)aligned_alloc(CACHE_LINE_SIZE, struct_size);
+    if (!queue) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+
+    queue->buff = malloc(real_cap * sizeof(void*));
+    if (!queue->buff) {
+        free(queue);
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+
+    atomic_init(&queue->tail, 0);
+    atomic_init(&queue->head, 0);
+    queue->cached_head = 0;
+    queue->cached_tail = 0;
+    queue->capacity = real_cap;
+    queue->mask = real_cap - 1;
+
+    return queue;
+}
+
+/*
+
+Appending an element to the end of a given queue.
+> Must be called only from the producer thread.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [queue], a queue, to the end of which an item should be appended
+    -> [item], an item, which should be appended to a given queue
+
+ Parameters [out]:
+    -> [bool], false if the queue is full and nothing was appended
+
+*/
+bool cqueueTryPush(CircularQueue* queue, void* item)
+{
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+
+    if (tail - queue->cached_head >= queue->capacity) {
+        queue->cached_head = atomic_load_explicit(&queue->head, memory_order_acquire);
+        if (tail - queue->cached_head >= queue->capacity) {
+            return false;
+        }
+    }
+
+    queue->buff[tail & queue->mask] = item;
+    atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+    return true;
+}
+
+/*
+
+Remove and getting the first element of a given queue.
+> Must be called only from the consumer thread.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [queue], a queue, the head of which should be removed
+    -> [item], a place, where the removed head should be written to
+
+ Parameters [out]:
+    -> [bool], false if the queue is empty and nothing was removed
+
+*/
+bool cqueueTryPop(CircularQueue* queue, void** item)
+{
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+
+    if (head == queue->cached_tail) {
+        queue->cached_tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        if (head == queue->cached_tail) {
+            return false;
+        }
+    }
+
+    *item = queue->buff[head & queue->mask];
+    atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+    return true;
+}
+
+/*
+
+Appending a batch of elements to the end of a given queue.
+> Must be called only from the producer thread.
+> Complex time - O(n).
+
+* As many elements as there are free slots are appended, and the
+consumer is notified once for the whole batch *
+
+ Parameters [in]:
+    -> [queue], a queue, to the end of which items should be appended
+    -> [items], an array of items, which should be appended
+    -> [count], the size of a given array
+
+ Parameters [out]:
+    -> [pushed], the number of items which were actually appended
+
+*/
+size_t cqueueTryPushN(CircularQueue* queue, void** items, size_t count)
+{
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+
+    size_t free_slots = queue->capacity - (tail - queue->cached_head);
+    if (free_slots < count) {
+        queue->cached_head = atomic_load_explicit(&queue->head, memory_order_acquire);
+        free_slots = queue->capacity - (tail - queue->cached_head);
+    }
+
+    size_t pushed = count < free_slots ? count : free_slots;
+    if (pushed == 0) {
+        return 0;
+    }
+
+    // The batch may get over the end of the buffer, so it is copied in two parts
+    size_t start = tail & queue->mask;
+    size_t first_part = queue->capacity - start;
+    first_part = first_part > pushed ? pushed : first_part;
+    memcpy(&(queue->buff[start]), items, first_part * sizeof(void*));
+    memcpy(&(queue->buff[0]), items + first_part, (pushed - first_part) * sizeof(void*));
+
+    atomic_store_explicit(&queue->tail, tail + pushed, memory_order_release);
+    return pushed;
+}
+
+/*
+
+Remove and getting a batch of first elements of a given queue.
+> Must be called only from the consumer thread.
+> Complex time - O(n).
+
+ Parameters [in]:
+    -> [queue], a queue, the first elements of which should be removed
+    -> [items], an array, where the removed elements should be written to
+    -> [count], the size of a given array
+
+ Parameters [out]:
+    -> [popped], the number of items which were actually removed
+
+*/
+size_t cqueueTryPopN(CircularQueue* queue, void** items, size_t count)
+{
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+
+    size_t available = queue->cached_tail - head;
+    if (available < count) {
+        queue->cached_tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        available = queue->cached_tail - head;
+    }
+
+    size_t popped = count < available ? count : available;
+    if (popped == 0) {
+        return 0;
+    }
+
+    size_t start = head & queue->mask;
+    size_t first_part = queue->capacity - start;
+    first_part = first_part > popped ? popped : first_part;
+    memcpy(items, &(queue->buff[start]), first_part * sizeof(void*));
+    memcpy(items + first_part, &(queue->buff[0]), (popped - first_part) * sizeof(void*));
+
+    atomic_store_explicit(&queue->head, head + popped, memory_order_release);
+    return popped;
+}
+
+/*
+
+Getting the size of a given queue.
+> Complex time - const.
+
+* If the other side is working at the same time, the result is
+just a snapshot, which may be already outdated *
+
+ Parameters [in]:
+    -> [queue], a queue, the size of which should be returned
+
+ Parameters [out]:
+    -> [size], the size of a given queue
+
+*/
+size_t cqueueSize(CircularQueue* queue)
+{
+    size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    return tail - head;
+}
+
+/*
+
+Checking if a given queue is empty or not.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [queue], a queue, which should be checked if it's empty or not
+
+ Parameters [out]:
+    -> [bool], the boolean result of checking if a given queue is empty or not
+
+*/
+bool cqueueIsEmpty(CircularQueue* queue)
+{
+    if (cqueueSize(queue) == 0)
+        return true;
+    return false;
+}
+
+/*
+
+Checking if a given queue is full or not.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [queue], a queue, which should be checked
+
+ Parameters [out]:
+    -> [bool], the boolean result of checking if a given queue is full or not
+
+*/
+bool cqueueIsFull(CircularQueue* queue)
+{
+    if (cqueueSize(queue) >= queue->capacity)
+        return true;
+    return false;
+}
+
+/*
+
+Clearing all memory that was allocated for the queue.
+> Neither of the sides may use the queue after that.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [queue], a queue, which should be deleted
+
+ Parameters [out]:
+    -> NULL
+*/
+void cqueueDelete(CircularQueue* queue)
+{
+    free(queue->buff);
+    free(queue);
+}
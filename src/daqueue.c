@@ -18,9 +18,16 @@ typedef struct Queue_type {
     size_t size;
     size_t capacity;
     double exp_val;
+    size_t head;
+    size_t tail;
     void **buff;
 } Queue;
 
+ The buffer is used as a ring: elements live in the slots from [head] up to
+ [tail] (exclusive), wrapping around the end of the buffer. The capacity is
+ always a power of two, so wrapping an index is just a mask (see the
+ 'daQueueWrap' macros) and every enqueue and dequeue is const.
+
 
 -> Macroses <-
 
@@ -67,9 +74,16 @@ start values *
     }
 
     queue->size = 0;
-    queue->capacity = STANDARD_CAPACITY;
+    queue->capacity = DA_QUEUE_CAPACITY;
     queue->exp_val = STANDARD_EXPANSION_VAL;
+    queue->head = 0;
+    queue->tail = 0;
     queue->buff = malloc(queue->capacity * sizeof(void*));
+    if (!queue->buff) {
+        free(queue);
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
 
     return queue;
 }
@@ -115,14 +129,16 @@ void daEnqueue(Queue* queue, void* item)
         daQueueExpandCapacity(queue);
     }
 
-    queue->buff[queue->size++] = item;
+    queue->buff[queue->tail] = item;
+    queue->tail = daQueueWrap(queue, queue->tail + 1);
+    queue->size++;
 }
 
 /*
 
 Remove and getting the first element of a given queue.
 > Given queue must not be empty.
-> Complex time - O(n).
+> Complex time - const.
 
  Parameters [in]:
     -> [queue], a queue, the head of which should be removed and returned
@@ -138,12 +154,8 @@ void* daDequeue(Queue* queue)
         return NULL;
     }
 
-    void* head = queue->buff[0];
-    memmove (
-        &(queue->buff[0]),
-        &(queue->buff[1]),
-        sizeof(void*) * queue->size
-    );
+    void* head = queue->buff[queue->head];
+    queue->head = daQueueWrap(queue, queue->head + 1);
     queue->size--;
     return head;
 }
@@ -168,7 +180,7 @@ void* daQueueFront(Queue* queue)
         return NULL;
     }
 
-    void* head = queue->buff[0];
+    void* head = queue->buff[queue->head];
     return head;
 }
 
@@ -192,7 +204,7 @@ void* daQueueRear(Queue* queue)
         return NULL;
     }
 
-    void* tail = queue->buff[queue->size - 1];
+    void* tail = queue->buff[daQueueWrap(queue, queue->tail - 1)];
     return tail;
 }
 
@@ -242,12 +254,12 @@ Checking if a given queue is full or not.
     -> [queue], a queue, which should be checked
 
  Parameters [out]:
-    -> [bool], the boolean result of checking if a given queue is full or not
+    -> [bool], true if the queue keeps DA_QUEUE_MAX_CAPACITY elements, i.e. the ring can't grow anymore
 
 */
 bool daQueueIsFull(Queue* queue)
 {
-    if (queue->size == MAXSIZE)
+    if (queue->size >= DA_QUEUE_MAX_CAPACITY)
         return true;
     return false;
 }
@@ -266,7 +278,7 @@ Checking is the size of a given queue is valid or not.
 */
 bool daQueueSizeIsValid(Queue* queue)
 {
-    if (queue->size <= MAXSIZE)
+    if (queue->size <= DA_QUEUE_MAX_CAPACITY)
         return true;
     return false;
 }
@@ -281,6 +293,11 @@ Expansion of the capacity when it is necessary.
 convenient because we are not to keep queue of a huge capacity in our
 memory, but just to expand it when it is necessary *
 
+* The new capacity is rounded up to the next power of two, so the ring
+masking keeps working. If the elements are wrapped around the end of
+the old buffer, the wrapped part is moved right after the old end, so
+the queue becomes contiguous in the new allocation *
+
  Parameters [in]:
     -> [queue], an queue capacity of which should be expanded
 
@@ -289,25 +306,47 @@ memory, but just to expand it when it is necessary *
 */
 void daQueueExpandCapacity(Queue* queue)
 {
-    if (queue->capacity >= MAXSIZE) {
+    if (queue->capacity >= DA_QUEUE_MAX_CAPACITY) {
         panic("'%s':%d: max capacity size exceeded", __FUNCTION__, __LINE__);
         exit(1);
     }
 
-    size_t temp_cap = queue->capacity * queue->exp_val;
-    temp_cap = temp_cap > MAXSIZE ? MAXSIZE : temp_cap;
+    size_t old_cap = queue->capacity;
+    size_t temp_cap = old_cap << 1;
+    while (temp_cap < old_cap * queue->exp_val && temp_cap < DA_QUEUE_MAX_CAPACITY) {
+        temp_cap <<= 1;
+    }
 
+    void** buff = realloc(queue->buff, temp_cap * sizeof(void*));
+    if (!buff) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+    queue->buff = buff;
     queue->capacity = temp_cap;
-    queue->buff = realloc(queue->buff, queue->capacity * sizeof(void*));
+
+    /*  Unwrapping the ring, i.e. if the old buffer looked like that:
+     *      | 5 | 6 | 1 | 2 | 3 | 4 |
+     *                head
+     *  the elements standing before the head are moved after the old end:
+     *      | - | - | 1 | 2 | 3 | 4 | 5 | 6 | - | - | - | - |
+     */
+    if (queue->head + queue->size > old_cap) {
+        size_t wrapped = queue->head + queue->size - old_cap;
+        memcpy(&(queue->buff[old_cap]), &(queue->buff[0]), wrapped * sizeof(void*));
+    }
+    queue->tail = daQueueWrap(queue, queue->head + queue->size);
 }
 
 /*
 
 Cutting the capacity of a given queue.
-> Complex time - const.
+> Complex time - O(n).
 
-* After this action the capacity of the queue will be
-equals to the number of its elements (size) *
+* After this action the capacity of the queue will be equals to the
+smallest power of two which is not less than the number of its
+elements (size), and the elements will start from the beginning
+of the buffer *
 
  Parameters [in]:
     -> [queue], an queue, the capacity of which sould be cut
@@ -317,11 +356,28 @@ equals to the number of its elements (size) *
 */
 void daQueueCutCapacity(Queue* queue)
 {
-    if (queue->size == 0) {
-        queue->capacity = STANDARD_CAPACITY;
-    } else {
-        queue->capacity = queue->size;
+    size_t new_cap = DA_QUEUE_CAPACITY;
+    while (new_cap < queue->size) {
+        new_cap <<= 1;
+    }
+
+    void** buff = malloc(new_cap * sizeof(void*));
+    if (!buff) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
     }
+
+    // Copying the part up to the end of the buffer and then the wrapped one
+    size_t first_part = queue->capacity - queue->head;
+    first_part = first_part > queue->size ? queue->size : first_part;
+    memcpy(&buff[0], &(queue->buff[queue->head]), first_part * sizeof(void*));
+    memcpy(&buff[first_part], &(queue->buff[0]), (queue->size - first_part) * sizeof(void*));
+
+    free(queue->buff);
+    queue->buff = buff;
+    queue->capacity = new_cap;
+    queue->head = 0;
+    queue->tail = daQueueWrap(queue, queue->size);
 }
 
 /*
@@ -338,7 +394,8 @@ Clearing a given queue without deleting allocated memory.
  void daQueueClear(Queue* queue)
 {
     queue->size = 0;
-    queue->capacity = STANDARD_CAPACITY;
+    queue->head = 0;
+    queue->tail = 0;
     queue->exp_val = STANDARD_EXPANSION_VAL;
 }
 
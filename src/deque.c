@@ -18,9 +18,16 @@ typedef struct Deque_type {
     size_t size;
     size_t capacity;
     double exp_val;
+    size_t head;
+    size_t tail;
     void **buff;
 } Deque;
 
+ The buffer is used as a ring: elements live in the slots from [head] up to
+ [tail] (exclusive), wrapping around the end of the buffer. The capacity is
+ always a power of two, so wrapping an index is just a mask (see the
+ 'dequeWrap' macros) and all four operations on the ends are const.
+
 
 -> Macroses <-
 
@@ -68,9 +75,16 @@ start values *
     }
 
     deque->size = 0;
-    deque->capacity = STANDARD_CAPACITY;
+    deque->capacity = DEQUE_CAPACITY;
     deque->exp_val = STANDARD_EXPANSION_VAL;
+    deque->head = 0;
+    deque->tail = 0;
     deque->buff = malloc(deque->capacity * sizeof(void*));
+    if (!deque->buff) {
+        free(deque);
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
 
     return deque;
 }
@@ -117,7 +131,9 @@ void dequeAdd(Deque* deque, void* item)
         dequeExpandCapacity(deque);
     }
 
-    deque->buff[deque->size++] = item;
+    deque->buff[deque->tail] = item;
+    deque->tail = dequeWrap(deque, deque->tail + 1);
+    deque->size++;
 }
 
 /*
@@ -138,15 +154,9 @@ void dequeAddLeft(Deque* deque, void* item)
     if (deque->size >= deque->capacity) {
         dequeExpandCapacity(deque);
     }
-	
-    size_t mem_block = sizeof(void*) * deque->size;
-    memmove (
-	&(deque->buff[1]),
-	&(deque->buff[0]),
-	mem_block
-    );
-
-    deque->buff[0] = item;
+
+    deque->head = dequeWrap(deque, deque->head - 1);
+    deque->buff[deque->head] = item;
     deque->size++;
 }
 
@@ -154,7 +164,7 @@ void dequeAddLeft(Deque* deque, void* item)
 
 Remove and getting the last element of a given deque.
 > Given deque must not be empty.
-> Complex time - O(n).
+> Complex time - const.
 
  Parameters [in]:
     -> [deque], a deque, the tail of which should be removed and returned
@@ -171,7 +181,10 @@ void* dequePop(Deque* deque)
     }
 
 
-    void* tail = deque->buff[--deque->size];
+    deque->tail = dequeWrap(deque, deque->tail - 1);
+    deque->size--;
+
+    void* tail = deque->buff[deque->tail];
     return tail;
 }
 
@@ -179,7 +192,7 @@ void* dequePop(Deque* deque)
 
 Remove and getting the first element of a given deque.
 > Given deque must not be empty.
-> Complex time - O(n).
+> Complex time - const.
 
  Parameters [in]:
     -> [deque], a deque, the head of which should be removed and returned
@@ -196,14 +209,8 @@ void* dequePopLeft(Deque* deque)
     }
 
 
-    void* head = deque->buff[0];
-    size_t mem_block = sizeof(void*) * deque->size;
-    memmove (
-        &(deque->buff[0]),
-        &(deque->buff[1]),
-        mem_block
-    );
-
+    void* head = deque->buff[deque->head];
+    deque->head = dequeWrap(deque, deque->head + 1);
     deque->size--;
     return head;
 }
@@ -228,7 +235,7 @@ void* dequeFront(Deque* deque)
         return NULL;
     }
 
-    void* head = deque->buff[0];
+    void* head = deque->buff[deque->head];
     return head;
 }
 
@@ -252,12 +259,41 @@ void* dequeRear(Deque* deque)
         return NULL;
     }
 
-    void* tail = deque->buff[deque->size - 1];
+    void* tail = deque->buff[dequeWrap(deque, deque->tail - 1)];
     return tail;
 }
 
 /*
 
+Getting the element standing on a specific position of a given deque.
+> Given deque must not be empty.
+> Given index must be within the bounds of the deque.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [deque], a deque, the element of which should be returned
+    -> [index], a position counted from the head of the deque
+
+ Parameters [out]:
+    -> [value], the element standing on a given position
+
+*/
+void* dequeAt(Deque* deque, size_t index)
+{
+    if (deque->size == 0) {
+        _EMPTY_QUEUE_ERROR;
+        return NULL;
+    } else if (index >= deque->size) {
+        _INDEX_ERROR(index);
+        return NULL;
+    }
+
+    void* value = deque->buff[dequeWrap(deque, deque->head + index)];
+    return value;
+}
+
+/*
+
 Getting the size of a given deque.
 > Complex time - const.
 
@@ -300,12 +336,12 @@ Checking if a given deque is full or not.
     -> [deque], a deque, which should be checked
  
  Parameters [out]:
-    -> [bool], the boolean result of checking if a given deque is full or not
+    -> [bool], true if the deque keeps DEQUE_MAX_CAPACITY elements, i.e. the ring can't grow anymore
 
 */
 bool dequeIsFull(Deque* deque)
 {
-    if (deque->size == MAXSIZE)
+    if (deque->size >= DEQUE_MAX_CAPACITY)
         return true;
     return false;
 }
@@ -324,7 +360,7 @@ Checking is the size of a given deque is valid or not.
 */
 bool dequeSizeIsValid(Deque* deque)
 {
-    if (deque->size <= MAXSIZE)
+    if (deque->size <= DEQUE_MAX_CAPACITY)
         return true;
     return false;
 }
@@ -338,6 +374,10 @@ Expansion of the capacity when it is necessary.
 * Actually this stuff is made due to dynamic memory allocation, it is very
 convenient because we are not to keep deque of a huge capacity in our
 memory, but just to expand it when it is necessary *
+
+* The new capacity is rounded up to the next power of two, so the ring
+masking keeps working. If the elements are wrapped around the end of
+the old buffer, the wrapped part is moved right after the old end *
  
  Parameters [in]:
     -> [deque], an deque capacity of which should be expanded
@@ -347,25 +387,42 @@ memory, but just to expand it when it is necessary *
 */
 void dequeExpandCapacity(Deque* deque)
 {
-    if (deque->capacity >= MAXSIZE) {
+    if (deque->capacity >= DEQUE_MAX_CAPACITY) {
         panic("'%s':%d: max capacity size exceeded", __FUNCTION__, __LINE__);
         exit(1);
     }
 
-    size_t temp_cap = deque->capacity * deque->exp_val;
-    temp_cap = temp_cap > MAXSIZE ? MAXSIZE : temp_cap;
+    size_t old_cap = deque->capacity;
+    size_t temp_cap = old_cap << 1;
+    while (temp_cap < old_cap * deque->exp_val && temp_cap < DEQUE_MAX_CAPACITY) {
+        temp_cap <<= 1;
+    }
 
+    void** buff = realloc(deque->buff, temp_cap * sizeof(void*));
+    if (!buff) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+    deque->buff = buff;
     deque->capacity = temp_cap;
-    deque->buff = realloc(deque->buff, deque->capacity * sizeof(void*));
+
+    // Unwrapping the ring, the same way as it is done for daQueue
+    if (deque->head + deque->size > old_cap) {
+        size_t wrapped = deque->head + deque->size - old_cap;
+        memcpy(&(deque->buff[old_cap]), &(deque->buff[0]), wrapped * sizeof(void*));
+    }
+    deque->tail = dequeWrap(deque, deque->head + deque->size);
 }
 
 /*
 
 Cutting the capacity of a given deque.
-> Complex time - const.
+> Complex time - O(n).
 
-* After this action the capacity of the deque will be
-equals to the number of its elements (size) *
+* After this action the capacity of the deque will be equals to the
+smallest power of two which is not less than the number of its
+elements (size), and the elements will start from the beginning
+of the buffer *
  
  Parameters [in]:
     -> [deque], an deque, the capacity of which sould be cut
@@ -375,11 +432,28 @@ equals to the number of its elements (size) *
 */
 void dequeCutCapacity(Deque* deque)
 {
-    if (deque->size == 0) {
-        deque->capacity = STANDARD_CAPACITY;
-    } else {
-        deque->capacity = deque->size;
+    size_t new_cap = DEQUE_CAPACITY;
+    while (new_cap < deque->size) {
+        new_cap <<= 1;
     }
+
+    void** buff = malloc(new_cap * sizeof(void*));
+    if (!buff) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+
+    // Copying the part up to the end of the buffer and then the wrapped one
+    size_t first_part = deque->capacity - deque->head;
+    first_part = first_part > deque->size ? deque->size : first_part;
+    memcpy(&buff[0], &(deque->buff[deque->head]), first_part * sizeof(void*));
+    memcpy(&buff[first_part], &(deque->buff[0]), (deque->size - first_part) * sizeof(void*));
+
+    free(deque->buff);
+    deque->buff = buff;
+    deque->capacity = new_cap;
+    deque->head = 0;
+    deque->tail = dequeWrap(deque, deque->size);
 }
 
 /*
@@ -396,7 +470,8 @@ Clearing a given deque without deleting allocated memory.
  void dequeClear(Deque* deque)
 {
     deque->size = 0;
-    deque->capacity = STANDARD_CAPACITY;
+    deque->head = 0;
+    deque->tail = 0;
     deque->exp_val = STANDARD_EXPANSION_VAL;
 }
 
@@ -416,3 +491,138 @@ Clearing all memory that was allocated for the deque.
     free(deque->buff);
     free(deque);
 }
+
+//////////////////////////////////////
+
+
+/*
+
+Creating an iterator for a given deque.
+> Complex time - const.
+
+* The iterator walks the deque from the head to the tail, getting over
+the end of the buffer by the ring masking, so every step is const *
+
+ Parameters [in]:
+    -> [deque], a deque, which should be wrapped in
+
+ Parameters [out]:
+    -> [iterator], a new created iterator
+
+*/
+DequeIterator* dequeIterNew(Deque* deque)
+{
+    DequeIterator* iterator = (DequeIterator*)malloc(sizeof(DequeIterator));
+    if (!iterator) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+
+    iterator->deque = deque;
+    iterator->curr_index = 0;
+    return iterator;
+}
+
+/*
+
+Checking if a given deque has the next element or not.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [iterator], an iterator, the next element of which we check
+
+ Parameters [out]:
+    -> [bool], the result of checking
+
+*/
+bool dequeIterHasNext(DequeIterator* iterator)
+{
+    if (iterator->curr_index >= iterator->deque->size) {
+        return false;
+    }
+    return true;
+}
+
+/*
+
+Checking if a given deque has the previous element or not.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [iterator], an iterator, the previous element of which we check
+
+ Parameters [out]:
+    -> [bool], the result of checking
+
+*/
+bool dequeIterHasPrev(DequeIterator* iterator)
+{
+    if (iterator->curr_index == 0) {
+        return false;
+    }
+    return true;
+}
+
+/*
+
+Getting the next element of a wrapped in deque.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [iterator], an iterator, the next element of which should be returned
+
+ Parameters [out]:
+    -> [next_el], the next element of wrapped in deque
+
+*/
+void* dequeIterNext(DequeIterator* iterator)
+{
+    if (!dequeIterHasNext(iterator)) {
+        return NULL;
+    }
+
+    Deque* deque = iterator->deque;
+    void* next_el = deque->buff[dequeWrap(deque, deque->head + iterator->curr_index)];
+    iterator->curr_index++;
+    return next_el;
+}
+
+/*
+
+Getting the previous element of a wrapped in deque.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [iterator], an iterator, the previous element of which should be returned
+
+ Parameters [out]:
+    -> [prev_el], the previous element of wrapped in deque
+
+*/
+void* dequeIterPrev(DequeIterator* iterator)
+{
+    if (!dequeIterHasPrev(iterator)) {
+        return NULL;
+    }
+
+    Deque* deque = iterator->deque;
+    iterator->curr_index--;
+    void* prev_el = deque->buff[dequeWrap(deque, deque->head + iterator->curr_index)];
+    return prev_el;
+}
+
+/*
+
+Clearing the memory that was allocated for the iterator.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [iterator], an iterator, which should be deleted
+
+ Parameters [out]:
+    -> NULL
+*/
+void dequeIterDelete(DequeIterator* iterator)
+{
+    free(iterator);
+}
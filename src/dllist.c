@@ -38,12 +38,11 @@ A short description of all:
 */
 
 #include "../include/dllist.h"
+#include "../include/list_merge.h"
 
 /*
     Features which will be added/fixed soon:
    - void listReverseMut(DList* list);
-   - void listSortMut(DList* list, DList*(*func)(DList*));
-   - DList* listSortNew(DList* list, DList*(*func)(DList*));
 */
 
 
@@ -71,6 +70,7 @@ DList* dlistNew()
     new_list->size = 0;
     new_list->head = NULL;
     new_list->tail = NULL;
+    poolInit(&new_list->pool, sizeof(Node));
 
     return new_list;
 }
@@ -78,7 +78,8 @@ DList* dlistNew()
 /*
 
 New node creation.
-> Complex time - O(n).
+> The node is allocated by itself and does not belong to any list.
+> Complex time - const.
 
  Parameters [in]:
     -> [value], a value, which should be the data of new node
@@ -105,8 +106,30 @@ Node* dnodeNew(void* value)
 
 /*
 
+New node creation from the pool of a given list.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [list], a list, which the node will belong to
+    -> [value], a value, which should be the data of new node
+
+ Parameters [out]:
+    -> [node], a new created node
+
+*/
+static Node* _dlistNodeNew__(DList* list, void* value)
+{
+    Node* new_node = (Node*)poolAlloc(&list->pool);
+    new_node->data = value;
+    new_node->next = NULL;
+    new_node->prev = NULL;
+    return new_node;
+}
+
+/*
+
 Appending a given element to the end of the list.
-> Complex time - O(n).
+> Complex time - const.
 
  Parameters [in]:
     -> [list], a list, to the end of which the element should be appended
@@ -117,20 +140,15 @@ Appending a given element to the end of the list.
 */
 void dlistPush(DList* list, void* value)
 {
-	if (!list->head) {
-		list->head = dnodeNew(value);
-        list->tail = list->head;
-	} else {
-		Node* curr_node = list->head;
-		while (curr_node->next) {
-			curr_node = curr_node->next;
-		}
-
-		curr_node->next = dnodeNew(value);
-		curr_node->next->prev = curr_node;
-        list->tail = curr_node->next;
-	}
-	list->size++;
+    Node* new_node = _dlistNodeNew__(list, value);
+    if (!list->head) {
+        list->head = new_node;
+    } else {
+        list->tail->next = new_node;
+        new_node->prev = list->tail;
+    }
+    list->tail = new_node;
+    list->size++;
 }
 
 /*
@@ -147,7 +165,7 @@ Prepending a given element to the beginning of the list.
 */
 void dlistPrepend(DList* list, void* value)
 {
-    Node* new_node = dnodeNew(value);
+    Node* new_node = _dlistNodeNew__(list, value);
     if (!list->head) {
         list->head = new_node;
         list->tail = list->head;
@@ -182,9 +200,12 @@ void dlistInsert(DList* list, void* value, size_t index)
         _EMPTY_LIST_ERROR;
     } else if (index > list->size) {
         _INDEX_ERROR(index);
+    // Inserting after the tail is just appending
+    } else if (index == list->size) {
+        dlistPush(list, value);
     } else {
         size_t curr_index = 1;
-        Node* new_node = dnodeNew(value);
+        Node* new_node = _dlistNodeNew__(list, value);
         Node* curr_node = list->head;
         while (curr_node) {
             Node* next_node = curr_node->next;
@@ -211,7 +232,7 @@ void dlistInsert(DList* list, void* value, size_t index)
 
 Remove the last element of a given list.
 > Given list must not be empty.
-> Complex time - O(n).
+> Complex time - const.
 
  Parameters [in]:
     -> [list], a list, the last element of which should be removed
@@ -223,18 +244,16 @@ void dlistRemoveEnd(DList* list)
 {
     if (!list->head) {
         _EMPTY_LIST_ERROR; return;
-    } else if (!list->head->next) {
-        free(list->head);
-        list->head = NULL;
+    }
+
+    Node* tail = list->tail;
+    list->tail = tail->prev;
+    if (list->tail) {
+        list->tail->next = NULL;
     } else {
-        Node* curr_node = list->head;
-        while (curr_node->next->next) {
-            curr_node = curr_node->next;
-        }
-        free(curr_node->next);
-        curr_node->next = NULL;
-        list->tail = curr_node;
+        list->head = NULL;
     }
+    poolFree(&list->pool, tail);
     list->size--;
 }
 
@@ -242,7 +261,7 @@ void dlistRemoveEnd(DList* list)
 
 Remove the first element of a given list.
 > Given list must not be empty.
-> Complex time - O(n).
+> Complex time - const.
 
  Parameters [in]:
     -> [list], a list, the first element of which should be removed
@@ -254,15 +273,16 @@ void dlistRemoveBegin(DList* list)
 {
     if (!list->head) {
         _EMPTY_LIST_ERROR; return;
-    } else if (list->size == 1) {
-        free(list->head);
-        free(list->tail);
-        list->head->data = NULL;
-        list->tail->data = NULL;
+    }
+
+    Node* head = list->head;
+    list->head = head->next;
+    if (list->head) {
+        list->head->prev = NULL;
     } else {
-        free(list->head);
-        list->head = list->head->next;
+        list->tail = NULL;
     }
+    poolFree(&list->pool, head);
     list->size--;
 }
 
@@ -297,6 +317,8 @@ void dlistRemoveAt(DList* list, size_t index)
             if (curr_index == index) {
                 last_node->next = curr_node->next;
                 curr_node->next->prev = last_node;
+                poolFree(&list->pool, curr_node);
+                break;
             }
             last_node = curr_node;
             curr_node = curr_node->next;
@@ -336,7 +358,7 @@ void dlistRemoveLast(DList* list, void* value)
          */
         size_t curr_index = 0;
         Node* curr_node = list->head;
-        size_t last_index;
+        size_t last_index = 0;
         while (curr_node) {
             if (curr_node->data == value) {
                 last_index = curr_index;
@@ -415,11 +437,13 @@ void dlistRemoveAll(DList* list, void* value)
         size_t curr_index = 0;
         Node* curr_node = list->head;
         while (curr_node) {
+            // The node is freed by 'dlistRemoveAt', so the next one is taken beforehand
+            Node* next_node = curr_node->next;
             if (curr_node->data == value) {
                 dlistRemoveAt(list, curr_index);
                 curr_index--;
             }
-            curr_node = curr_node->next;
+            curr_node = next_node;
             curr_index++;
         }
     }
@@ -668,7 +692,11 @@ DList* ddlistShallCopy(DList* list)
 /*
 
 Making and return a deep copy of a given list.
-> Complex time - const.
+> Complex time - O(n).
+
+* Every node is copied into a node of the new list, so the copies share
+no nodes and each one may be changed or deleted alone. The elements are
+not owned by a list, so both lists point to the same elements *
 
  Parameters [in]:
     -> [list], a list, a deep copy of which should be returned
@@ -679,18 +707,12 @@ Making and return a deep copy of a given list.
 */
 DList* dlistDeepCopy(DList* list)
 {
-    if (!list->head) {
-        return list;
-    }
-
     DList* copied_list = dlistNew();
-
-    /*  Here we directly assign the head node of a given list
-     * to the head of a new one, that's why all changes in the new list
-     * will affect the old one.
-     */
-    copied_list->head = list->head;
-    copied_list->size = list->size;
+    Node* curr_node = list->head;
+    while (curr_node) {
+        dlistPush(copied_list, curr_node->data);
+        curr_node = curr_node->next;
+    }
     return copied_list;
 }
 
@@ -975,18 +997,13 @@ Extending a given list by another one.
 */
 void dlistExtend(DList* f_list, DList* s_list)
 {
-    if (!f_list->head) {
-        f_list->head = s_list->head;
-        f_list->size = s_list->size;
-    } else {
-        /*  Appending nodes from the second list to the first list
-         * thereby extending the first one.
-         */
-        Node* s_list_node = s_list->head;
-        while (s_list_node) {
-            dlistPush(f_list, s_list_node->data);
-            s_list_node = s_list_node->next;
-        }
+    /*  Appending nodes from the second list to the first list
+     * thereby extending the first one, every append is const.
+     */
+    Node* s_list_node = s_list->head;
+    while (s_list_node) {
+        dlistPush(f_list, s_list_node->data);
+        s_list_node = s_list_node->next;
     }
 }
 
@@ -1007,15 +1024,94 @@ void dswapLists(DList* f_list, DList* s_list)
     Node* temp_head = f_list->head;
     Node* temp_tail = f_list->tail;
     size_t temp_size = f_list->size;
+    NodePool temp_pool = f_list->pool;
     
-    // Just swap the head nodes of two lists.
+    // Just swap the head nodes of two lists, the nodes go with their pools.
     f_list->head = s_list->head;
     f_list->tail = s_list->tail;
     f_list->size = s_list->size;
+    f_list->pool = s_list->pool;
 
     s_list->head = temp_head;
     s_list->tail = temp_tail;
     s_list->size = temp_size;
+    s_list->pool = temp_pool;
+}
+
+/*
+
+Merge sort algorithm.
+> Complex time - O(n*log(n)).
+
+* Nodes are relinked by the merge sort shared with List, see "include/list_merge.h",
+so nodes with equal elements keep their order and nothing is allocated. It
+sets only the [next] links, so the [prev] ones are restored in one pass after it *
+
+ Parameters [in]:
+    -> [list], a list, which should be sorted
+    -> [cmp], a comparator of elements, if it is NULL the raw values are compared
+    -> [ctx], a pointer, which is passed to every call of [cmp]
+
+ Parameters [out]:
+    -> NULL
+*/
+void dlistMergeSort(DList* list, DListCompare cmp, void* ctx)
+{
+    const ListNodeLayout layout = { offsetof(Node, data), offsetof(Node, next) };
+    void* tail;
+    list->head = (Node*)listMergeChain(list->head, &layout, cmp, ctx, &tail);
+    list->tail = (Node*)tail;
+
+    Node* prev = NULL;
+    for (Node* curr_node = list->head; curr_node; curr_node = curr_node->next) {
+        curr_node->prev = prev;
+        prev = curr_node;
+    }
+}
+
+/*
+
+Sorting a given list 'in-place', i.e. the list is mutable.
+> Complex time - depending on what kind of sorting algorithm is used here,
+O(n*log(n)) for the default merge sort.
+
+ Parameters [in]:
+    -> [list], a list, which should be sorted by a given function
+    -> [func], a function, which should sort a given list, if it is NULL merge sort is used
+    -> [cmp], a comparator of elements, if it is NULL the raw values are compared
+    -> [ctx], a pointer, which is passed to every call of [cmp]
+
+ Parameters [out]:
+    -> NULL
+*/
+void dlistSortMut(DList* list, DListSortFunc func, DListCompare cmp, void* ctx)
+{
+    if (!func) {
+        func = dlistMergeSort;
+    }
+    func(list, cmp, ctx);
+}
+
+/*
+
+Creating a copy of a given list, sorting it and return.
+> Complex time - depending on what kind of sorting algorithm is used here.
+
+ Parameters [in]:
+    -> [list], a list, a copy of which sould be sorted
+    -> [func], a function, which should sort a given list, if it is NULL merge sort is used
+    -> [cmp], a comparator of elements, if it is NULL the raw values are compared
+    -> [ctx], a pointer, which is passed to every call of [cmp]
+
+ Parameters [out]:
+    -> [new_list], a sorted copy of given list
+
+*/
+DList* dlistSortNew(DList* list, DListSortFunc func, DListCompare cmp, void* ctx)
+{
+    DList* sorted_list = ddlistShallCopy(list);
+    dlistSortMut(sorted_list, func, cmp, ctx);
+    return sorted_list;
 }
 
 /*
@@ -1047,9 +1143,8 @@ Clearing a given list without deleting allocated memory, shallow clearing.
 
 /*
 
-Clearing a given list with deleting allocated memory, actually remove.
-> Given list must not be empty.
-> Complex time - O(n).
+Clearing all memory that was allocated for the nodes of the list.
+> Complex time - O(slabs), all nodes are freed together with the slabs of the pool.
 
  Parameters [in]:
     -> [list], a list, which should be removed
@@ -1057,20 +1152,9 @@ Clearing a given list with deleting allocated memory, actually remove.
  Parameters [out]:
     -> NULL
 */
- void dlistDelete(DList* list)
+void dlistDelete(DList* list)
 {
-    if (!list->head) {
-        panic("%s:%d: cannot remove empty list", __FILE__, __LINE__);
-        exit(1);   
-    }
-
-    Node* curr_node = list->head;
-    Node* next;
-    while (curr_node) {
-        next = curr_node->next;
-        free(curr_node);
-        curr_node = next;
-    }
+    poolRelease(&list->pool);
     list->head = NULL;
     list->tail = NULL;
     list->size = 0;
@@ -0,0 +1,329 @@
+/*
+
+-> Eytzinger Index collection (Base: implicit balanced tree in BFS order) <-
+
+This software is free and can be used and modifyied by anyone
+under the terms of the GNU General Public License as
+published by the Free Software Foundation, either version 3
+of the License, or any later version.
+
+[Author] -> Stacey Kerr
+[Github] -> https://github.com/wiseStann
+
+
+-> Structure <-
+
+typedef struct EytzingerIndex_type {
+    size_t size;
+    size_t full_steps;
+    EytzCompare cmp;
+    void** keys;
+    size_t* ranks;
+} EytzingerIndex;
+
+ The index is built once from sorted keys and never changes. The keys
+ are laid out as a balanced tree walked breadth-first: the root stands
+ at 1 and the children of [k] at [2k] and [2k + 1]. So the top levels,
+ which every lookup touches, share a few cache lines, and the sixteen
+ descendants four levels below [k] stand in two neighbour cache lines,
+ which are prefetched long before the descent reaches them.
+
+ The descent has no branches: every step goes to [2k + (key[k] < key)],
+ and all lookups make the same number of steps. Where the lower bound
+ stands is found from the final [k] at the end: the last step to the
+ left is the last zero bit of [k].
+
+
+-> Macroses <-
+
+ Check Error macroses in "include/basic.h" header file.
+ -> [_MEMORY_ALLOCATION_ERROR], a macros for notification about memory allocation error
+
+*/
+
+#include "../include/eytzinger.h"
+
+// How far below the current key the descent prefetches, the keys [16k, 16k + 15] are four levels down
+#define EYTZ_PREFETCH_STRIDE 16
+
+
+static inline size_t _eytzLess__(EytzingerIndex* index, void* a, void* key)
+{
+    if (index->cmp) {
+        return index->cmp(a, key) < 0;
+    }
+    return (uintptr_t)a < (uintptr_t)key;
+}
+
+static inline void _eytzPrefetch__(EytzingerIndex* index, size_t position)
+{
+    const char* block = (const char*)(index->keys + EYTZ_PREFETCH_STRIDE * position);
+    __builtin_prefetch(block);
+    __builtin_prefetch(block + CACHE_LINE_SIZE);
+}
+
+/*
+
+Turning the final position of a descent into the position of the lower bound.
+> Complex time - const.
+
+* The descent stops below the last key where it went to the left, i.e.
+after the last zero bit of [position]; that bit and the ones after it
+are cut off. If the descent never went left, nothing is left and the
+lower bound is behind all keys *
+
+ Parameters [in]:
+    -> [index], an index, which was searched
+    -> [position], the position, where the descent stopped
+
+ Parameters [out]:
+    -> [position], the place of the first key not less than the searched one, 0 if there is no such key
+
+*/
+static inline size_t _eytzFinish__(size_t position)
+{
+    return position >> __builtin_ffsll(~(unsigned long long)position);
+}
+
+/*
+
+Descending to the first key, which is not less than a given one.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [index], a non-empty index, which should be searched
+    -> [key], a key, which does not have to be in the index
+
+ Parameters [out]:
+    -> [position], the place of the found key, 0 if all keys are less
+
+*/
+static size_t _eytzSearch__(EytzingerIndex* index, void* key)
+{
+    size_t position = 1;
+    for (size_t step = 0; step < index->full_steps; step++) {
+        _eytzPrefetch__(index, position);
+        position = 2 * position + _eytzLess__(index, index->keys[position], key);
+    }
+    if (position <= index->size) {
+        position = 2 * position + _eytzLess__(index, index->keys[position], key);
+    }
+    return _eytzFinish__(position);
+}
+
+/*
+
+Putting sorted keys in the breadth-first order of a subtree.
+> Complex time - O(n), the recursion is only O(log(n)) deep.
+
+ Parameters [in]:
+    -> [index], an index, which is being built
+    -> [sorted], sorted keys
+    -> [position], the root of a subtree, which should be filled
+    -> [next], the sorted position of the first key of the subtree
+
+ Parameters [out]:
+    -> [next], the sorted position of the first key after the subtree
+
+*/
+static size_t _eytzFill__(EytzingerIndex* index, Array* sorted, size_t position, size_t next)
+{
+    if (position > index->size) {
+        return next;
+    }
+
+    next = _eytzFill__(index, sorted, 2 * position, next);
+    index->keys[position] = sorted->buff[next];
+    index->ranks[position] = next;
+    return _eytzFill__(index, sorted, 2 * position + 1, next + 1);
+}
+
+/*
+
+Creating a new index from sorted keys.
+> Complex time - O(n).
+
+ Parameters [in]:
+    -> [keys], an array of keys, sorted and without duplicates, it is copied
+    -> [cmp], a comparator of keys, if it is NULL the raw values are compared
+
+ Parameters [out]:
+    -> [index], a new created index, or NULL if keys are not sorted
+
+*/
+EytzingerIndex* eytzNew(Array* keys, EytzCompare cmp)
+{
+    EytzingerIndex* index = (EytzingerIndex*)malloc(sizeof(EytzingerIndex));
+    if (!index) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+
+    index->size = keys->size;
+    index->cmp = cmp;
+    for (size_t i = 1; i < index->size; i++) {
+        if (!_eytzLess__(index, keys->buff[i - 1], keys->buff[i])) {
+            panic("in '%s': given keys are not sorted or not unique", __FUNCTION__);
+            free(index);
+            return NULL;
+        }
+    }
+
+    // The size is rounded up to the cache line, as aligned_alloc wants
+    size_t bytes = (index->size + 1) * sizeof(void*);
+    bytes = (bytes + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+    index->keys = (void**)aligned_alloc(CACHE_LINE_SIZE, bytes);
+    index->ranks = (size_t*)malloc((index->size + 1) * sizeof(size_t));
+    if (!index->keys || !index->ranks) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+
+    // The unused place 0 is where the descent ends when all keys are less
+    index->keys[0] = NULL;
+    index->ranks[0] = index->size;
+    _eytzFill__(index, keys, 1, 0);
+
+    // The levels above the last one are complete, i.e. floor(log2(size)) of them
+    index->full_steps = 0;
+    while (index->size >> (index->full_steps + 1)) {
+        index->full_steps++;
+    }
+    return index;
+}
+
+/*
+
+Getting the sorted position of the first key, which is not less than a given one.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [index], an index, which should be searched
+    -> [key], a key, which does not have to be in the index
+
+ Parameters [out]:
+    -> [rank], the sorted position of the found key, or the size of index if all keys are less
+
+*/
+size_t eytzLowerBound(EytzingerIndex* index, void* key)
+{
+    if (!index->size) {
+        return 0;
+    }
+    return index->ranks[_eytzSearch__(index, key)];
+}
+
+/*
+
+Getting the lower bounds of many keys at once.
+> Complex time - O(count * log(n)).
+
+* The lookups of a batch descend level by level together, so the cache
+misses of different lookups overlap instead of waiting one by one *
+
+ Parameters [in]:
+    -> [index], an index, which should be searched
+    -> [keys], the keys, which should be searched
+    -> [count], the number of keys
+    -> [ranks], a place, where the results are written to, as [eytzLowerBound] returns them
+
+ Parameters [out]:
+    -> NULL
+*/
+void eytzLowerBoundBatch(EytzingerIndex* index, void** keys, size_t count, size_t* ranks)
+{
+    size_t positions[EYTZ_BATCH_SIZE];
+
+    for (size_t start = 0; start < count; start += EYTZ_BATCH_SIZE) {
+        size_t batch = count - start < EYTZ_BATCH_SIZE ? count - start : EYTZ_BATCH_SIZE;
+        if (!index->size) {
+            memset(ranks + start, 0, batch * sizeof(size_t));
+            continue;
+        }
+
+        for (size_t j = 0; j < batch; j++) {
+            positions[j] = 1;
+        }
+        for (size_t step = 0; step < index->full_steps; step++) {
+            for (size_t j = 0; j < batch; j++) {
+                size_t position = positions[j];
+                _eytzPrefetch__(index, position);
+                positions[j] = 2 * position + _eytzLess__(index, index->keys[position], keys[start + j]);
+            }
+        }
+        for (size_t j = 0; j < batch; j++) {
+            size_t position = positions[j];
+            if (position <= index->size) {
+                position = 2 * position + _eytzLess__(index, index->keys[position], keys[start + j]);
+            }
+            ranks[start + j] = index->ranks[_eytzFinish__(position)];
+        }
+    }
+}
+
+/*
+
+Searching the sorted position of a given key.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [index], an index, which should be searched
+    -> [key], a key, which should be found
+    -> [rank], a place, where the sorted position should be written to, may be NULL
+
+ Parameters [out]:
+    -> [bool], the result of searching a key
+
+*/
+bool eytzFind(EytzingerIndex* index, void* key, size_t* rank)
+{
+    if (!index->size) {
+        return false;
+    }
+
+    size_t position = _eytzSearch__(index, key);
+    if (!position || _eytzLess__(index, key, index->keys[position])) {
+        return false;
+    }
+
+    if (rank) {
+        *rank = index->ranks[position];
+    }
+    return true;
+}
+
+/*
+
+Checking if a given index contains a given key.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [index], an index, which should be checked
+    -> [key], a key, which should be searched
+
+ Parameters [out]:
+    -> [bool], the result of searching a key
+
+*/
+bool eytzContains(EytzingerIndex* index, void* key)
+{
+    return eytzFind(index, key, NULL);
+}
+
+/*
+
+Clearing all memory that was allocated for the index.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [index], an index, which should be deleted
+
+ Parameters [out]:
+    -> NULL
+*/
+void eytzDelete(EytzingerIndex* index)
+{
+    free(index->keys);
+    free(index->ranks);
+    free(index);
+}
@@ -1 +1,821 @@
+/*
 
+-> Hash Table collection (Base: open addressing, Swiss table) <-
+
+This software is free and can be used and modifyied by anyone
+under the terms of the GNU General Public License as
+published by the Free Software Foundation, either version 3
+of the License, or any later version.
+
+[Author] -> Stacey Kerr
+[Github] -> https://github.com/wiseStann
+
+
+-> Structure <-
+
+typedef struct HTSlot_type {
+    void* key;
+    void* value;
+} HTSlot;
+
+typedef struct HashTable_type {
+    size_t size;
+    size_t capacity;
+    size_t growth_left;
+    HTHash hash;
+    HTEqual equal;
+    int8_t* ctrl;
+    HTSlot* slots;
+    bool incremental;
+    int8_t* old_ctrl;
+    HTSlot* old_slots;
+    size_t old_capacity;
+    size_t migrate_pos;
+} HashTable;
+
+ The slots are split into groups of HT_GROUP_WIDTH. Besides the slots the
+ table keeps a separate array of control bytes, one per slot: HT_CTRL_EMPTY,
+ HT_CTRL_DELETED (a tombstone), or the low 7 bits of the hash (h2) of the
+ key standing in the slot. The rest of the hash (h1) chooses the first
+ group to probe, and the next groups are chosen by triangular probing.
+
+ A lookup compares h2 with all control bytes of a group at once (with
+ SSE2, when it is available), so only the slots whose control byte
+ matches are touched, and the search stops at the first group which
+ has an empty slot. So in most cases a lookup reads one line of control
+ bytes and one slot.
+
+ The table is rehashed when no empty slots are left for growth (the load
+ factor is kept under 7/8). If more than a half of the used slots are
+ tombstones the table is rebuilt with the same capacity, otherwise the
+ capacity is doubled.
+
+ In the incremental mode the rehash does not move all elements at once.
+ The old storage is kept next to the new one, every insert, lookup and
+ erase moves HT_REHASH_STEP groups of it, and 'htStepRehash' lets idle
+ code move more. Until the old storage is empty, new elements go to the
+ new storage and lookups check both of them; moved slots of the old
+ storage are marked as deleted, so a key is never found there twice.
+
+
+-> Macroses <-
+
+ Check Error macroses in "include/basic.h" header file.
+ -> [_MEMORY_ALLOCATION_ERROR], a macros for notification about memory allocation error
+
+*/
+
+#include "../include/hashtable.h"
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+
+/*
+
+Getting a bitmask of the slots of a group, the control bytes of which are equal to a given one.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [group], the control bytes of the group
+    -> [byte], a control byte, which should be matched
+
+ Parameters [out]:
+    -> [mask], the bit [i] is set if the control byte [i] is equal to a given one
+
+*/
+static inline uint32_t _htGroupMatch__(const int8_t* group, int8_t byte)
+{
+#if defined(__SSE2__)
+    __m128i ctrl = _mm_load_si128((const __m128i*)group);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(byte), ctrl));
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < HT_GROUP_WIDTH; i++) {
+        mask |= (uint32_t)(group[i] == byte) << i;
+    }
+    return mask;
+#endif
+}
+
+/*
+
+Getting a bitmask of the slots of a group, which keep no element.
+> Complex time - const.
+
+* Both empty and deleted control bytes have the high bit set *
+
+ Parameters [in]:
+    -> [group], the control bytes of the group
+
+ Parameters [out]:
+    -> [mask], the bit [i] is set if the slot [i] is empty or deleted
+
+*/
+static inline uint32_t _htGroupMatchFree__(const int8_t* group)
+{
+#if defined(__SSE2__)
+    __m128i ctrl = _mm_load_si128((const __m128i*)group);
+    return (uint32_t)_mm_movemask_epi8(ctrl);
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < HT_GROUP_WIDTH; i++) {
+        mask |= (uint32_t)(group[i] < 0) << i;
+    }
+    return mask;
+#endif
+}
+
+/*
+
+Hashing a key of a given table.
+> Complex time - const.
+
+* The result of the user hash is mixed, so that both its high bits (h1)
+and low bits (h2) are good enough even for weak user functions *
+
+ Parameters [in]:
+    -> [ht], a table, the hash function of which should be used
+    -> [key], a key, which should be hashed
+
+ Parameters [out]:
+    -> [hash], the hash of a given key
+
+*/
+static inline uint64_t _htHash__(HashTable* ht, const void* key)
+{
+    uint64_t hash = ht->hash ? (uint64_t)ht->hash(key) : (uint64_t)(uintptr_t)key;
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+/*
+
+Comparing two keys of a given table.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [ht], a table, the equality function of which should be used
+    -> [a], [b], keys, which should be compared
+
+ Parameters [out]:
+    -> [bool], the result of comparing
+
+*/
+static inline bool _htEqual__(HashTable* ht, const void* a, const void* b)
+{
+    if (ht->equal) {
+        return ht->equal(a, b);
+    }
+    return a == b;
+}
+
+/*
+
+Searching a slot with a given key in a given storage.
+> Complex time - const on average.
+
+ Parameters [in]:
+    -> [ht], a table, the equality function of which should be used
+    -> [ctrl], [slots], [capacity], the storage, which should be searched
+    -> [key], a key, which should be found
+    -> [hash], the hash of a given key
+
+ Parameters [out]:
+    -> [index], the position of the slot, or SIZE_MAX if there is no such key
+
+*/
+static size_t _htFindSlot__(HashTable* ht, const int8_t* ctrl, const HTSlot* slots,
+                            size_t capacity, const void* key, uint64_t hash)
+{
+    size_t groups_mask = capacity / HT_GROUP_WIDTH - 1;
+    size_t group = (size_t)(hash >> 7) & groups_mask;
+    int8_t h2 = (int8_t)(hash & 0x7F);
+
+    for (size_t step = 1; step <= groups_mask + 1; step++) {
+        const int8_t* group_ctrl = &ctrl[group * HT_GROUP_WIDTH];
+
+        uint32_t match = _htGroupMatch__(group_ctrl, h2);
+        while (match) {
+            size_t index = group * HT_GROUP_WIDTH + __builtin_ctz(match);
+            if (_htEqual__(ht, slots[index].key, key)) {
+                return index;
+            }
+            match &= match - 1;
+        }
+
+        // The key would have been put in this group, if it was in the storage
+        if (_htGroupMatch__(group_ctrl, HT_CTRL_EMPTY)) {
+            return SIZE_MAX;
+        }
+        group = (group + step) & groups_mask;
+    }
+    return SIZE_MAX;
+}
+
+/*
+
+Searching the first slot without an element on the probe sequence of a given hash.
+> Complex time - const on average.
+
+ Parameters [in]:
+    -> [ctrl], [capacity], the control bytes of the storage, which should be searched
+    -> [hash], the hash of a key, which is going to be inserted
+
+ Parameters [out]:
+    -> [index], the position of an empty or deleted slot
+
+*/
+static size_t _htFindFree__(const int8_t* ctrl, size_t capacity, uint64_t hash)
+{
+    size_t groups_mask = capacity / HT_GROUP_WIDTH - 1;
+    size_t group = (size_t)(hash >> 7) & groups_mask;
+
+    // There is always at least one empty slot, because the load factor is under 7/8
+    for (size_t step = 1;; step++) {
+        uint32_t free_mask = _htGroupMatchFree__(&ctrl[group * HT_GROUP_WIDTH]);
+        if (free_mask) {
+            return group * HT_GROUP_WIDTH + __builtin_ctz(free_mask);
+        }
+        group = (group + step) & groups_mask;
+    }
+}
+
+/*
+
+Allocating control bytes and slots of a given capacity.
+> Complex time - O(n).
+
+ Parameters [in]:
+    -> [ht], a table, the storage of which should be allocated
+    -> [capacity], the number of slots
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _htAllocate__(HashTable* ht, size_t capacity)
+{
+    ht->ctrl = (int8_t*)aligned_alloc(HT_GROUP_WIDTH, capacity);
+    ht->slots = (HTSlot*)malloc(capacity * sizeof(HTSlot));
+    if (!ht->ctrl || !ht->slots) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+
+    memset(ht->ctrl, HT_CTRL_EMPTY, capacity);
+    ht->capacity = capacity;
+    ht->growth_left = capacity - capacity / 8;
+}
+
+/*
+
+Moving groups of the old storage to the current one.
+> Complex time - O(budget).
+
+* When the last group is moved, the old storage is freed *
+
+ Parameters [in]:
+    -> [ht], a table, which is being rehashed
+    -> [budget], the maximum number of groups, which should be moved
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _htMigrate__(HashTable* ht, size_t budget)
+{
+    size_t old_groups = ht->old_capacity / HT_GROUP_WIDTH;
+
+    while (budget-- > 0 && ht->migrate_pos < old_groups) {
+        size_t first = ht->migrate_pos * HT_GROUP_WIDTH;
+        uint32_t full = ~_htGroupMatchFree__(&(ht->old_ctrl[first])) & 0xFFFF;
+
+        while (full) {
+            size_t old_index = first + __builtin_ctz(full);
+            uint64_t hash = _htHash__(ht, ht->old_slots[old_index].key);
+            size_t index = _htFindFree__(ht->ctrl, ht->capacity, hash);
+
+            ht->ctrl[index] = (int8_t)(hash & 0x7F);
+            ht->slots[index] = ht->old_slots[old_index];
+            ht->old_ctrl[old_index] = HT_CTRL_DELETED;
+            ht->growth_left--;
+            full &= full - 1;
+        }
+        ht->migrate_pos++;
+    }
+
+    if (ht->migrate_pos >= old_groups) {
+        free(ht->old_ctrl);
+        free(ht->old_slots);
+        ht->old_ctrl = NULL;
+        ht->old_slots = NULL;
+        ht->old_capacity = 0;
+        ht->migrate_pos = 0;
+    }
+}
+
+/*
+
+Moving all elements of a given table to a new storage of a given capacity.
+> Complex time - O(n), or const in the incremental mode.
+
+* Tombstones are not moved, so after that all free slots are empty.
+In the incremental mode only the new storage is allocated here, and
+the elements are moved later by '_htMigrate__' *
+
+ Parameters [in]:
+    -> [ht], a table, which should be rehashed
+    -> [capacity], the number of slots of the new storage
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _htRehash__(HashTable* ht, size_t capacity)
+{
+    // Only one old storage can exist, so the previous rehash is finished
+    if (ht->old_ctrl) {
+        _htMigrate__(ht, SIZE_MAX);
+    }
+
+    ht->old_ctrl = ht->ctrl;
+    ht->old_slots = ht->slots;
+    ht->old_capacity = ht->capacity;
+    ht->migrate_pos = 0;
+
+    _htAllocate__(ht, capacity);
+
+    if (!ht->incremental) {
+        _htMigrate__(ht, SIZE_MAX);
+    }
+}
+
+/*
+
+Making the place for one more element when no empty slots are left for growth.
+> Complex time - O(n), or const in the incremental mode.
+
+ Parameters [in]:
+    -> [ht], a table, which should be rehashed
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _htRehashForGrowth__(HashTable* ht)
+{
+    // Moving the rest of the old storage may already free enough place
+    if (ht->old_ctrl) {
+        _htMigrate__(ht, SIZE_MAX);
+        if (ht->growth_left > 0) {
+            return;
+        }
+    }
+
+    // Most of the used slots are tombstones, so it is enough to drop them
+    if (ht->size <= (ht->capacity - ht->capacity / 8) / 2) {
+        _htRehash__(ht, ht->capacity);
+    } else if (ht->capacity >= HT_MAX_CAPACITY) {
+        panic("'%s':%d: max capacity size exceeded", __FUNCTION__, __LINE__);
+        exit(1);
+    } else {
+        _htRehash__(ht, ht->capacity * 2);
+    }
+}
+
+/*
+
+Searching a given key in both storages of a given table.
+> Complex time - const on average.
+
+* If the key is found, [in_old] tells which storage keeps it *
+
+ Parameters [in]:
+    -> [ht], a table, which should be searched
+    -> [key], a key, which should be found
+    -> [hash], the hash of a given key
+    -> [in_old], a place, where the storage of the found key should be written to
+
+ Parameters [out]:
+    -> [index], the position of the slot, or SIZE_MAX if there is no such key
+
+*/
+static size_t _htLookup__(HashTable* ht, const void* key, uint64_t hash, bool* in_old)
+{
+    if (ht->old_ctrl) {
+        _htMigrate__(ht, HT_REHASH_STEP);
+    }
+
+    *in_old = false;
+    size_t index = _htFindSlot__(ht, ht->ctrl, ht->slots, ht->capacity, key, hash);
+    if (index != SIZE_MAX || !ht->old_ctrl) {
+        return index;
+    }
+
+    *in_old = true;
+    return _htFindSlot__(ht, ht->old_ctrl, ht->old_slots, ht->old_capacity, key, hash);
+}
+
+/*
+
+Creating a new hash table.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [hash], a hash function of keys, if it is NULL raw keys are hashed
+    -> [equal], an equality function of keys, if it is NULL raw keys are compared
+
+ Parameters [out]:
+    -> [ht], a new created hash table
+
+*/
+HashTable* htNew(HTHash hash, HTEqual equal)
+{
+    HashTable* ht = (HashTable*)malloc(sizeof(HashTable));
+    if (!ht) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+
+    ht->size = 0;
+    ht->hash = hash;
+    ht->equal = equal;
+    ht->incremental = false;
+    ht->old_ctrl = NULL;
+    ht->old_slots = NULL;
+    ht->old_capacity = 0;
+    ht->migrate_pos = 0;
+    _htAllocate__(ht, HT_STANDARD_CAPACITY);
+
+    return ht;
+}
+
+/*
+
+Inserting a key with a value in a given table.
+> Complex time - const on average.
+
+* If the key is already in the table only its value is replaced *
+
+ Parameters [in]:
+    -> [ht], a table, in which the key should be inserted
+    -> [key], a key, which should be inserted
+    -> [value], a value of a given key
+
+ Parameters [out]:
+    -> [bool], true if the key was not in the table before
+
+*/
+bool htInsert(HashTable* ht, void* key, void* value)
+{
+    uint64_t hash = _htHash__(ht, key);
+    bool in_old;
+
+    size_t index = _htLookup__(ht, key, hash, &in_old);
+    if (index != SIZE_MAX) {
+        // A key of the old storage keeps its slot until its group is moved
+        HTSlot* slots = in_old ? ht->old_slots : ht->slots;
+        slots[index].value = value;
+        return false;
+    }
+
+    index = _htFindFree__(ht->ctrl, ht->capacity, hash);
+    // A tombstone can be reused for free, but an empty slot is taken from the growth
+    if (ht->ctrl[index] == HT_CTRL_EMPTY) {
+        if (ht->growth_left == 0) {
+            _htRehashForGrowth__(ht);
+            index = _htFindFree__(ht->ctrl, ht->capacity, hash);
+        }
+        ht->growth_left--;
+    }
+
+    ht->ctrl[index] = (int8_t)(hash & 0x7F);
+    ht->slots[index].key = key;
+    ht->slots[index].value = value;
+    ht->size++;
+    return true;
+}
+
+/*
+
+Searching a value of a given key.
+> Complex time - const on average.
+
+ Parameters [in]:
+    -> [ht], a table, which should be searched
+    -> [key], a key, the value of which should be found
+    -> [value], a place, where the found value should be written to, may be NULL
+
+ Parameters [out]:
+    -> [bool], the result of searching a key
+
+*/
+bool htFind(HashTable* ht, void* key, void** value)
+{
+    bool in_old;
+    size_t index = _htLookup__(ht, key, _htHash__(ht, key), &in_old);
+    if (index == SIZE_MAX) {
+        return false;
+    }
+
+    if (value) {
+        *value = in_old ? ht->old_slots[index].value : ht->slots[index].value;
+    }
+    return true;
+}
+
+/*
+
+Checking if a given table contains a given key.
+> Complex time - const on average.
+
+ Parameters [in]:
+    -> [ht], a table, which should be checked
+    -> [key], a key, which should be searched
+
+ Parameters [out]:
+    -> [bool], the result of searching a key
+
+*/
+bool htContains(HashTable* ht, void* key)
+{
+    return htFind(ht, key, NULL);
+}
+
+/*
+
+Remove a given key from a given table.
+> Complex time - const on average.
+
+* If the group of the slot has an empty slot, no probe sequence
+has ever passed through this group, so the slot becomes empty
+again, otherwise it becomes a tombstone *
+
+ Parameters [in]:
+    -> [ht], a table, from which the key should be removed
+    -> [key], a key, which should be removed
+
+ Parameters [out]:
+    -> [bool], false if there was no such key in the table
+
+*/
+bool htErase(HashTable* ht, void* key)
+{
+    bool in_old;
+    size_t index = _htLookup__(ht, key, _htHash__(ht, key), &in_old);
+    if (index == SIZE_MAX) {
+        return false;
+    }
+
+    // The old storage is never inserted to, so a tombstone there costs nothing
+    if (in_old) {
+        ht->old_ctrl[index] = HT_CTRL_DELETED;
+        ht->size--;
+        return true;
+    }
+
+    const int8_t* group = &(ht->ctrl[index & ~((size_t)HT_GROUP_WIDTH - 1)]);
+    if (_htGroupMatch__(group, HT_CTRL_EMPTY)) {
+        ht->ctrl[index] = HT_CTRL_EMPTY;
+        ht->growth_left++;
+    } else {
+        ht->ctrl[index] = HT_CTRL_DELETED;
+    }
+    ht->size--;
+    return true;
+}
+
+/*
+
+Reserving the place for a given number of elements.
+> Complex time - O(n).
+
+* After that a given number of elements can be kept in the table
+without any rehashing *
+
+ Parameters [in]:
+    -> [ht], a table, the capacity of which should be expanded
+    -> [count], the number of elements
+
+ Parameters [out]:
+    -> NULL
+*/
+void htReserve(HashTable* ht, size_t count)
+{
+    size_t capacity = HT_STANDARD_CAPACITY;
+    while (capacity - capacity / 8 < count) {
+        if (capacity >= HT_MAX_CAPACITY) {
+            panic("'%s':%d: max capacity size exceeded", __FUNCTION__, __LINE__);
+            exit(1);
+        }
+        capacity <<= 1;
+    }
+
+    if (capacity > ht->capacity) {
+        _htRehash__(ht, capacity);
+    }
+}
+
+/*
+
+Turning the incremental rehashing of a given table on or off.
+> Complex time - const, or O(n) if a rehash has to be finished.
+
+* When the mode is turned off, the rehash in progress is finished at once *
+
+ Parameters [in]:
+    -> [ht], a table, the mode of which should be changed
+    -> [incremental], true if rehashes should move the elements step by step
+
+ Parameters [out]:
+    -> NULL
+*/
+void htSetIncremental(HashTable* ht, bool incremental)
+{
+    ht->incremental = incremental;
+    if (!incremental && ht->old_ctrl) {
+        _htMigrate__(ht, SIZE_MAX);
+    }
+}
+
+/*
+
+Moving a part of the old storage during an incremental rehash.
+> Complex time - O(budget).
+
+* Every group has HT_GROUP_WIDTH slots, so a given budget bounds the
+work. It is intended to be called from idle loops to finish a rehash
+before the next operations have to do it *
+
+ Parameters [in]:
+    -> [ht], a table, which is being rehashed
+    -> [budget], the maximum number of groups, which should be moved
+
+ Parameters [out]:
+    -> [bool], true if the rehash is still in progress
+
+*/
+bool htStepRehash(HashTable* ht, size_t budget)
+{
+    if (ht->old_ctrl) {
+        _htMigrate__(ht, budget);
+    }
+    return ht->old_ctrl != NULL;
+}
+
+/*
+
+Checking if an incremental rehash of a given table is in progress or not.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [ht], a table, which should be checked
+
+ Parameters [out]:
+    -> [bool], the result of checking
+
+*/
+bool htIsRehashing(HashTable* ht)
+{
+    if (ht->old_ctrl)
+        return true;
+    return false;
+}
+
+/*
+
+Calling a given function for every element of a given table.
+> The table must not be changed by a given function.
+> Complex time - O(n).
+
+ Parameters [in]:
+    -> [ht], a table, the elements of which should be visited
+    -> [visit], a function, which is called with every key and its value
+    -> [ctx], a user argument passed to a given function
+
+ Parameters [out]:
+    -> NULL
+*/
+void htForEach(HashTable* ht, void (*visit)(void* key, void* value, void* ctx), void* ctx)
+{
+    for (size_t i = 0; i < ht->capacity; i++) {
+        if (ht->ctrl[i] >= 0) {
+            visit(ht->slots[i].key, ht->slots[i].value, ctx);
+        }
+    }
+
+    // Moved slots of the old storage are marked as deleted, so they are skipped
+    for (size_t i = 0; ht->old_ctrl && i < ht->old_capacity; i++) {
+        if (ht->old_ctrl[i] >= 0) {
+            visit(ht->old_slots[i].key, ht->old_slots[i].value, ctx);
+        }
+    }
+}
+
+/*
+
+Checking if a given table is empty or not.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [ht], a table, which should be checked if it's empty or not
+
+ Parameters [out]:
+    -> [bool], the boolean result of checking if a given table is empty or not
+
+*/
+bool htIsEmpty(HashTable* ht)
+{
+    if (ht->size == 0)
+        return true;
+    return false;
+}
+
+/*
+
+Hashing a null-terminated string (FNV-1a).
+> Complex time - O(n).
+
+ Parameters [in]:
+    -> [key], a string, which should be hashed
+
+ Parameters [out]:
+    -> [hash], the hash of a given string
+
+*/
+size_t htHashString(const void* key)
+{
+    const unsigned char* str = (const unsigned char*)key;
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    while (*str) {
+        hash ^= *str++;
+        hash *= 0x100000001b3ULL;
+    }
+    return (size_t)hash;
+}
+
+/*
+
+Comparing two null-terminated strings.
+> Complex time - O(n).
+
+ Parameters [in]:
+    -> [a], [b], strings, which should be compared
+
+ Parameters [out]:
+    -> [bool], true if the strings are equal
+
+*/
+bool htEqualString(const void* a, const void* b)
+{
+    return strcmp((const char*)a, (const char*)b) == 0;
+}
+
+/*
+
+Clearing a given table without deleting allocated memory.
+> Complex time - O(n).
+
+ Parameters [in]:
+    -> [ht], a table, which should be cleared
+
+ Parameters [out]:
+    -> NULL
+*/
+void htClear(HashTable* ht)
+{
+    if (ht->old_ctrl) {
+        free(ht->old_ctrl);
+        free(ht->old_slots);
+        ht->old_ctrl = NULL;
+        ht->old_slots = NULL;
+        ht->old_capacity = 0;
+        ht->migrate_pos = 0;
+    }
+
+    memset(ht->ctrl, HT_CTRL_EMPTY, ht->capacity);
+    ht->size = 0;
+    ht->growth_left = ht->capacity - ht->capacity / 8;
+}
+
+/*
+
+Clearing all memory that was allocated for the table.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [ht], a table, which should be deleted
+
+ Parameters [out]:
+    -> NULL
+*/
+void htDelete(HashTable* ht)
+{
+    free(ht->old_ctrl);
+    free(ht->old_slots);
+    free(ht->ctrl);
+    free(ht->slots);
+    free(ht);
+}
@@ -0,0 +1,396 @@
+/*
+
+-> Intrusive Doubly Linked List collection (Base: links embedded in user's structures) <-
+
+This software is free and can be used and modifyied by anyone
+under the terms of the GNU General Public License as
+published by the Free Software Foundation, either version 3
+of the License, or any later version.
+
+[Author] -> Stacey Kerr
+[Github] -> https://github.com/wiseStann
+
+
+-> Structure <-
+
+typedef struct IListLink_type {
+    struct IListLink_type* next;
+    struct IListLink_type* prev;
+} IListLink;
+
+typedef struct IList_type {
+    IListLink head;
+} IList;
+
+ The list doesn't allocate anything. A user's structure keeps an IListLink
+ field and the list links these fields together, so an element costs no
+ extra allocation and no extra pointer hop. The structure is taken back
+ from a link by [ilistEntry] macros.
+
+ The list is a ring closed by the [head] link of the list itself, so
+ there are no NULL checks on insertion and removal, and a link can be
+ unlinked knowing nothing about its list. For the same reason the list
+ doesn't keep its size, see [ilistLength].
+
+ An unlinked link points to itself, so [ilistIsLinked] tells if an
+ element is in some list. The memory of elements is always owned by the
+ user.
+
+
+-> Macroses <-
+
+ -> [ilistEntry], getting a structure from a pointer to its link field
+ -> [ilistForEach], [ilistForEachReverse], walking the links of a list
+ -> [ilistForEachSafe], walking the links of a list, which may be unlinked on the way
+ -> [ilistForEachEntry], walking the structures linked in a list
+
+*/
+
+#include "../include/ilist.h"
+
+
+/*
+
+Initialization of an empty list.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [list], a list, which should be initialized
+
+ Parameters [out]:
+    -> NULL
+*/
+void ilistInit(IList* list)
+{
+    list->head.next = &list->head;
+    list->head.prev = &list->head;
+}
+
+/*
+
+Initialization of a link, that is not in any list.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [link], a link, which should be initialized
+
+ Parameters [out]:
+    -> NULL
+*/
+void ilistLinkInit(IListLink* link)
+{
+    link->next = link;
+    link->prev = link;
+}
+
+/*
+
+Checking if a given link is in some list or not.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [link], an initialized link, which should be checked
+
+ Parameters [out]:
+    -> [bool], true if the link is in a list
+
+*/
+bool ilistIsLinked(IListLink* link)
+{
+    return link->next != link;
+}
+
+/*
+
+Checking if a given list is empty or not.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [list], a list, which should be checked
+
+ Parameters [out]:
+    -> [bool], true if the list is empty
+
+*/
+bool ilistIsEmpty(IList* list)
+{
+    return list->head.next == &list->head;
+}
+
+/*
+
+Counting the links of a given list.
+> Complex time - O(n).
+
+ Parameters [in]:
+    -> [list], a list, the links of which should be counted
+
+ Parameters [out]:
+    -> [length], the number of links
+
+*/
+size_t ilistLength(IList* list)
+{
+    size_t length = 0;
+    IListLink* link;
+    ilistForEach(link, list) {
+        length++;
+    }
+    return length;
+}
+
+/*
+
+Linking a new link between two neighbour ones.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [link], a link, which should be linked
+    -> [prev], a link, which should stand before it
+    -> [next], a link, which should stand after it
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _ilistLinkBetween__(IListLink* link, IListLink* prev, IListLink* next)
+{
+    link->prev = prev;
+    link->next = next;
+    prev->next = link;
+    next->prev = link;
+}
+
+/*
+
+Appending a given link to the end of the list.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [list], a list, to the end of which the link should be appended
+    -> [link], a link, which is not in any list
+
+ Parameters [out]:
+    -> NULL
+*/
+void ilistPush(IList* list, IListLink* link)
+{
+    _ilistLinkBetween__(link, list->head.prev, &list->head);
+}
+
+/*
+
+Prepending a given link to the beginning of the list.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [list], a list, to the beginning of which the link should be prepended
+    -> [link], a link, which is not in any list
+
+ Parameters [out]:
+    -> NULL
+*/
+void ilistPrepend(IList* list, IListLink* link)
+{
+    _ilistLinkBetween__(link, &list->head, list->head.next);
+}
+
+/*
+
+Inserting a given link after another one.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [pos], a link of a list, after which the link should stand
+    -> [link], a link, which is not in any list
+
+ Parameters [out]:
+    -> NULL
+*/
+void ilistInsertAfter(IListLink* pos, IListLink* link)
+{
+    _ilistLinkBetween__(link, pos, pos->next);
+}
+
+/*
+
+Inserting a given link before another one.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [pos], a link of a list, before which the link should stand
+    -> [link], a link, which is not in any list
+
+ Parameters [out]:
+    -> NULL
+*/
+void ilistInsertBefore(IListLink* pos, IListLink* link)
+{
+    _ilistLinkBetween__(link, pos->prev, pos);
+}
+
+/*
+
+Removing a given link from its list, the link may be linked again after that.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [link], a link, which should be removed, unlinking of an unlinked link does nothing
+
+ Parameters [out]:
+    -> NULL
+*/
+void ilistUnlink(IListLink* link)
+{
+    link->prev->next = link->next;
+    link->next->prev = link->prev;
+    ilistLinkInit(link);
+}
+
+/*
+
+Getting the first link of a given list.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [list], a list, the first link of which should be returned
+
+ Parameters [out]:
+    -> [link], the first link
+
+*/
+IListLink* ilistGetBegin(IList* list)
+{
+    if (ilistIsEmpty(list)) {
+        _EMPTY_LIST_ERROR;
+        return NULL;
+    }
+    return list->head.next;
+}
+
+/*
+
+Getting the last link of a given list.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [list], a list, the last link of which should be returned
+
+ Parameters [out]:
+    -> [link], the last link
+
+*/
+IListLink* ilistGetEnd(IList* list)
+{
+    if (ilistIsEmpty(list)) {
+        _EMPTY_LIST_ERROR;
+        return NULL;
+    }
+    return list->head.prev;
+}
+
+/*
+
+Removing the last link of a given list and returning it.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [list], a list, the last link of which should be removed
+
+ Parameters [out]:
+    -> [end], the removed link
+
+*/
+IListLink* ilistPop(IList* list)
+{
+    IListLink* end = ilistGetEnd(list);
+    if (end) {
+        ilistUnlink(end);
+    }
+    return end;
+}
+
+/*
+
+Removing the first link of a given list and returning it.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [list], a list, the first link of which should be removed
+
+ Parameters [out]:
+    -> [begin], the removed link
+
+*/
+IListLink* ilistPoll(IList* list)
+{
+    IListLink* begin = ilistGetBegin(list);
+    if (begin) {
+        ilistUnlink(begin);
+    }
+    return begin;
+}
+
+/*
+
+Moving all links of a given list before another link, the given list gets empty.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [pos], a link, before which the links should stand, it may be the head of a list
+    -> [list], a list, the links of which should be moved, it must not contain [pos]
+
+ Parameters [out]:
+    -> NULL
+*/
+void ilistSpliceBefore(IListLink* pos, IList* list)
+{
+    if (ilistIsEmpty(list)) {
+        return;
+    }
+
+    IListLink* first = list->head.next;
+    IListLink* last = list->head.prev;
+    first->prev = pos->prev;
+    pos->prev->next = first;
+    last->next = pos;
+    pos->prev = last;
+    ilistInit(list);
+}
+
+/*
+
+Moving all links of the second list to the end of the first one, the second list gets empty.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [f_list], a list, to the end of which the links should be moved
+    -> [s_list], a list, the links of which should be moved
+
+ Parameters [out]:
+    -> NULL
+*/
+void ilistSplice(IList* f_list, IList* s_list)
+{
+    ilistSpliceBefore(&f_list->head, s_list);
+}
+
+/*
+
+Swapping two given lists.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [f_list], first list for swapping
+    -> [s_list], second list for swapping
+
+ Parameters [out]:
+    -> NULL
+*/
+void iswapLists(IList* f_list, IList* s_list)
+{
+    IList temp;
+    ilistInit(&temp);
+    ilistSplice(&temp, f_list);
+    ilistSplice(f_list, s_list);
+    ilistSplice(s_list, &temp);
+}
@@ -0,0 +1,234 @@
+/*
+
+-> Sorting algorithms for Singly Linked List data structure <-
+
+This software is free and can be used and modifyied by anyone
+under the terms of the GNU General Public License as
+published by the Free Software Foundation, either version 3
+of the License, or any later version.
+
+[Author] -> Stacey Kerr
+[Github] -> https://github.com/wiseStann
+
+
+ Every algorithm takes a list and a comparator with a context pointer,
+ which is passed to every comparison. If the comparator is NULL, the raw
+ values of elements are compared.
+
+ Merge sort is the default one. It does not move data between nodes, but
+ relinks them. Nodes are taken from the list one by one and merged into
+ bins, the bin [i] holds a sorted sublist of 2^i nodes or nothing, like
+ bits of a binary counter. So the sort is bottom-up, needs no recursion
+ and no memory except the bins on the stack. The core of it works on any
+ node layout, see "include/list_merge.h", and is shared with DList.
+
+*/
+
+#include "../include/list_sortings.h"
+
+
+static int _listCompareRaw__(const void* a, const void* b, void* ctx)
+{
+    (void)ctx;
+    return (a > b) - (a < b);
+}
+
+/*
+
+Bubble sort algorithm.
+> Complex time - O(n^2).
+
+ Parameters [in]:
+    -> [list], a list, which should be sorted
+    -> [cmp], a comparator of elements, if it is NULL the raw values are compared
+    -> [ctx], a pointer, which is passed to every call of [cmp]
+
+ Parameters [out]:
+    -> NULL
+*/
+void listBubbleSort(List* list, ListCompare cmp, void* ctx)
+{
+    cmp = cmp ? cmp : _listCompareRaw__;
+    if (!list->head) {
+        return;
+    }
+
+    bool swapped = true;
+    while (swapped) {
+        swapped = false;
+        Node* curr_node = list->head;
+        while (curr_node->next) {
+            Node* next_node = curr_node->next;
+            if (cmp(curr_node->data, next_node->data, ctx) > 0) {
+                void* data = curr_node->data;
+                curr_node->data = next_node->data;
+                next_node->data = data;
+                swapped = true;
+            }
+            curr_node = next_node;
+        }
+    }
+}
+
+/*
+
+Selection sort algorithm.
+> Complex time - O(n^2).
+
+ Parameters [in]:
+    -> [list], a list, which should be sorted
+    -> [cmp], a comparator of elements, if it is NULL the raw values are compared
+    -> [ctx], a pointer, which is passed to every call of [cmp]
+
+ Parameters [out]:
+    -> NULL
+*/
+void listSelectionSort(List* list, ListCompare cmp, void* ctx)
+{
+    cmp = cmp ? cmp : _listCompareRaw__;
+
+    Node* head = list->head;
+    while (head) {
+        Node* min = head;
+        Node* next_node = head->next;
+        while (next_node) {
+            if (cmp(next_node->data, min->data, ctx) < 0) {
+                min = next_node;
+            }
+            next_node = next_node->next;
+        }
+        void* data = head->data;
+        head->data = min->data;
+        min->data = data;
+        head = head->next;
+    }
+}
+
+// Getting the [next] link of a node of any layout
+static inline void** _listNextOf__(const ListNodeLayout* layout, void* node)
+{
+    return (void**)((char*)node + layout->next);
+}
+
+// Getting the element of a node of any layout
+static inline void* _listDataOf__(const ListNodeLayout* layout, void* node)
+{
+    return *(void**)((char*)node + layout->data);
+}
+
+/*
+
+Merging two sorted chains of nodes, only the [next] links are set.
+> Complex time - O(n + m).
+
+ Parameters [in]:
+    -> [first], a chain, which nodes stood earlier in the list
+    -> [second], a chain, which nodes stood later in the list
+    -> [layout], the places of the element and of the link in a node
+    -> [cmp], [ctx], a comparator of elements and its context
+
+ Parameters [out]:
+    -> [head], the head of the merged chain, equal nodes of [first] stand before those of [second]
+
+*/
+static void* _listMerge__(void* first, void* second, const ListNodeLayout* layout, ListCompare cmp, void* ctx)
+{
+    void* head = NULL;
+    void** link = &head;
+    while (first && second) {
+        if (cmp(_listDataOf__(layout, second), _listDataOf__(layout, first), ctx) < 0) {
+            *link = second;
+            second = *_listNextOf__(layout, second);
+        } else {
+            *link = first;
+            first = *_listNextOf__(layout, first);
+        }
+        link = _listNextOf__(layout, *link);
+    }
+    *link = first ? first : second;
+    return head;
+}
+
+/*
+
+Merge sort of a chain of nodes, the base of merge sorts of all linked lists.
+> Complex time - O(n*log(n)).
+
+* Nodes are taken from the chain one by one and merged into bins, the bin
+[i] holds a sorted sublist of 2^i nodes or nothing. Nodes with equal
+elements keep their order. Only [next] links are changed, so a list with
+other links, e.g. [prev], has to restore them after that *
+
+ Parameters [in]:
+    -> [head], the first node of a chain terminated by NULL, may be NULL
+    -> [layout], the places of the element and of the link in a node
+    -> [cmp], a comparator of elements, if it is NULL the raw values are compared
+    -> [ctx], a pointer, which is passed to every call of [cmp]
+    -> [tail], a place, where the last node of the sorted chain is written
+
+ Parameters [out]:
+    -> [head], the first node of the sorted chain
+
+*/
+void* listMergeChain(void* head, const ListNodeLayout* layout, ListCompare cmp, void* ctx, void** tail)
+{
+    cmp = cmp ? cmp : _listCompareRaw__;
+
+    void* bins[LIST_MERGE_BINS] = { NULL };
+    size_t used = 0;
+
+    void* curr_node = head;
+    while (curr_node) {
+        void* carry = curr_node;
+        curr_node = *_listNextOf__(layout, curr_node);
+        *_listNextOf__(layout, carry) = NULL;
+
+        // The bins hold earlier nodes than the carry, so they are merged as the first ones
+        size_t i = 0;
+        for (; i < used && bins[i]; i++) {
+            carry = _listMerge__(bins[i], carry, layout, cmp, ctx);
+            bins[i] = NULL;
+        }
+        bins[i] = carry;
+        if (i == used) {
+            used++;
+        }
+    }
+
+    head = NULL;
+    for (size_t i = 0; i < used; i++) {
+        if (bins[i]) {
+            head = _listMerge__(bins[i], head, layout, cmp, ctx);
+        }
+    }
+
+    void* last = head;
+    while (last && *_listNextOf__(layout, last)) {
+        last = *_listNextOf__(layout, last);
+    }
+    *tail = last;
+    return head;
+}
+
+/*
+
+Merge sort algorithm.
+> Complex time - O(n*log(n)).
+
+* Nodes with equal elements keep their order *
+
+ Parameters [in]:
+    -> [list], a list, which should be sorted
+    -> [cmp], a comparator of elements, if it is NULL the raw values are compared
+    -> [ctx], a pointer, which is passed to every call of [cmp]
+
+ Parameters [out]:
+    -> NULL
+*/
+void listMergeSort(List* list, ListCompare cmp, void* ctx)
+{
+    const ListNodeLayout layout = { offsetof(Node, data), offsetof(Node, next) };
+    void* tail;
+    list->head = (Node*)listMergeChain(list->head, &layout, cmp, ctx, &tail);
+    list->tail = (Node*)tail;
+}
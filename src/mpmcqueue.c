@@ -0,0 +1,414 @@
+/*
+
+-> MPMC Queue collection (Base: Ring Buffer, lock-free MPMC) <-
+
+This software is free and can be used and modifyied by anyone
+under the terms of the GNU General Public License as
+published by the Free Software Foundation, either version 3
+of the License, or any later version.
+
+[Author] -> Stacey Kerr
+[Github] -> https://github.com/wiseStann
+
+
+-> Structure <-
+
+typedef struct MPMCCell_type {
+    atomic_size_t sequence;
+    void* data;
+} MPMCCell;
+
+typedef struct MPMCQueue_type {
+    atomic_size_t tail;
+    atomic_size_t head;
+
+    size_t capacity;
+    size_t mask;
+    MPMCCell* cells;
+
+    atomic_size_t push_waiters;
+    atomic_size_t pop_waiters;
+    pthread_mutex_t park_lock;
+    pthread_cond_t not_full;
+    pthread_cond_t not_empty;
+} MPMCQueue;
+
+ Any number of threads may push and pop at the same time. Every cell keeps
+ a sequence number: a cell at position [pos] is free for a producer when
+ its sequence equals [pos], and it is ready for a consumer when its
+ sequence equals [pos + 1]. So producers and consumers only race for
+ their own index with a CAS and never share a lock.
+
+ The blocking calls spin for a while and then park the thread on a
+ condition variable. The other side takes the lock only if it sees
+ that somebody is parked, so the fast path stays lock-free.
+
+
+-> Macroses <-
+
+ Check Error macroses in "include/basic.h" header file.
+ -> [_MEMORY_ALLOCATION_ERROR], a macros for notification about memory allocation error
+
+*/
+
+#include "../include/mpmcqueue.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+    #define _mpmcQueueRelax__() __builtin_ia32_pause()
+#else
+    #define _mpmcQueueRelax__() ((void)0)
+#endif
+
+
+/*
+
+Creating a new MPMC queue.
+> Complex time - O(n).
+
+* A given capacity is rounded up to the next power of two, at least 2 *
+
+ Parameters [in]:
+    -> [capacity], the minimum number of elements the queue should keep
+
+ Parameters [out]:
+    -> [queue], a new created queue
+
+*/
+MPMCQueue* mpmcQueueNew(size_t capacity)
+{
+    if (capacity == 0 || capacity > MPMC_QUEUE_MAX_CAPACITY) {
+        panic("in '%s': capacity %zu is not supported", __FUNCTION__, capacity);
+        exit(1);
+    }
+
+    size_t real_cap = 2;
+    while (real_cap < capacity) {
+        real_cap <<= 1;
+    }
+
+    size_t struct_size = (sizeof(MPMCQueue) + CACHE_LINE_SIZE - 1) & ~((size_t)CACHE_LINE_SIZE - 1);
+    MPMCQueue* queue = (MPMCQueue*)aligned_alloc(CACHE_LINE_SIZE, struct_size);
+    if (!queue) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+
+    queue->cells = (MPMCCell*)malloc(real_cap * sizeof(MPMCCell));
+    if (!queue->cells) {
+        free(queue);
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+
+    // Every cell is ready for the producer of the first lap
+    for (size_t i = 0; i < real_cap; i++) {
+        atomic_init(&queue->cells[i].sequence, i);
+        queue->cells[i].data = NULL;
+    }
+
+    atomic_init(&queue->tail, 0);
+    atomic_init(&queue->head, 0);
+    atomic_init(&queue->push_waiters, 0);
+    atomic_init(&queue->pop_waiters, 0);
+    queue->capacity = real_cap;
+    queue->mask = real_cap - 1;
+
+    pthread_mutex_init(&queue->park_lock, NULL);
+    pthread_cond_init(&queue->not_full, NULL);
+    pthread_cond_init(&queue->not_empty, NULL);
+
+    return queue;
+}
+
+/*
+
+Waking up threads parked on a given condition, if there are any.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [queue], a queue, the threads of which should be woken up
+    -> [waiters], the counter of threads parked on the condition
+    -> [cond], the condition, which should be signaled
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _mpmcQueueWake__(MPMCQueue* queue, atomic_size_t* waiters, pthread_cond_t* cond)
+{
+    /* Pairs with the fence in the parking path: either the parked thread
+       sees our change of the cell, or we see its counter */
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(waiters, memory_order_relaxed) == 0) {
+        return;
+    }
+
+    pthread_mutex_lock(&queue->park_lock);
+    pthread_cond_signal(cond);
+    pthread_mutex_unlock(&queue->park_lock);
+}
+
+/*
+
+Appending an element to the end of a given queue without waiting.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [queue], a queue, to the end of which an item should be appended
+    -> [item], an item, which should be appended to a given queue
+
+ Parameters [out]:
+    -> [bool], false if the queue is full and nothing was appended
+
+*/
+static bool _mpmcQueueTryPush__(MPMCQueue* queue, void* item)
+{
+    size_t pos = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    MPMCCell* cell;
+
+    for (;;) {
+        cell = &queue->cells[pos & queue->mask];
+        size_t seq = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+        if (diff == 0) {
+            // The cell is free, trying to take this position before other producers
+            if (atomic_compare_exchange_weak_explicit(&queue->tail, &pos, pos + 1,
+                    memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // The cell still keeps an element of the previous lap
+            return false;
+        } else {
+            pos = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+        }
+    }
+
+    cell->data = item;
+    atomic_store_explicit(&cell->sequence, pos + 1, memory_order_release);
+    return true;
+}
+
+/*
+
+Remove and getting the first element of a given queue without waiting.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [queue], a queue, the head of which should be removed
+    -> [item], a place, where the removed head should be written to
+
+ Parameters [out]:
+    -> [bool], false if the queue is empty and nothing was removed
+
+*/
+static bool _mpmcQueueTryPop__(MPMCQueue* queue, void** item)
+{
+    size_t pos = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    MPMCCell* cell;
+
+    for (;;) {
+        cell = &queue->cells[pos & queue->mask];
+        size_t seq = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&queue->head, &pos, pos + 1,
+                    memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // The producer of this lap has not written the cell yet
+            return false;
+        } else {
+            pos = atomic_load_explicit(&queue->head, memory_order_relaxed);
+        }
+    }
+
+    *item = cell->data;
+    // Making the cell free for the producer of the next lap
+    atomic_store_explicit(&cell->sequence, pos + queue->mask + 1, memory_order_release);
+    return true;
+}
+
+/*
+
+Appending an element to the end of a given queue.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [queue], a queue, to the end of which an item should be appended
+    -> [item], an item, which should be appended to a given queue
+
+ Parameters [out]:
+    -> [bool], false if the queue is full and nothing was appended
+
+*/
+bool mpmcQueueTryPush(MPMCQueue* queue, void* item)
+{
+    if (!_mpmcQueueTryPush__(queue, item)) {
+        return false;
+    }
+
+    _mpmcQueueWake__(queue, &queue->pop_waiters, &queue->not_empty);
+    return true;
+}
+
+/*
+
+Remove and getting the first element of a given queue.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [queue], a queue, the head of which should be removed
+    -> [item], a place, where the removed head should be written to
+
+ Parameters [out]:
+    -> [bool], false if the queue is empty and nothing was removed
+
+*/
+bool mpmcQueueTryPop(MPMCQueue* queue, void** item)
+{
+    if (!_mpmcQueueTryPop__(queue, item)) {
+        return false;
+    }
+
+    _mpmcQueueWake__(queue, &queue->push_waiters, &queue->not_full);
+    return true;
+}
+
+/*
+
+Appending an element to the end of a given queue, waiting while it is full.
+> Complex time - const, if the queue is not full.
+
+* Firstly the call spins for MPMC_QUEUE_SPIN_LIMIT tries, and only
+then the thread is parked until some consumer frees a slot *
+
+ Parameters [in]:
+    -> [queue], a queue, to the end of which an item should be appended
+    -> [item], an item, which should be appended to a given queue
+
+ Parameters [out]:
+    -> NULL
+*/
+void mpmcQueuePush(MPMCQueue* queue, void* item)
+{
+    for (int i = 0; i < MPMC_QUEUE_SPIN_LIMIT; i++) {
+        if (mpmcQueueTryPush(queue, item)) {
+            return;
+        }
+        _mpmcQueueRelax__();
+    }
+
+    pthread_mutex_lock(&queue->park_lock);
+    atomic_fetch_add_explicit(&queue->push_waiters, 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    while (!_mpmcQueueTryPush__(queue, item)) {
+        pthread_cond_wait(&queue->not_full, &queue->park_lock);
+    }
+    atomic_fetch_sub_explicit(&queue->push_waiters, 1, memory_order_relaxed);
+    pthread_mutex_unlock(&queue->park_lock);
+
+    _mpmcQueueWake__(queue, &queue->pop_waiters, &queue->not_empty);
+}
+
+/*
+
+Remove and getting the first element of a given queue, waiting while it is empty.
+> Complex time - const, if the queue is not empty.
+
+* Firstly the call spins for MPMC_QUEUE_SPIN_LIMIT tries, and only
+then the thread is parked until some producer appends an element *
+
+ Parameters [in]:
+    -> [queue], a queue, the head of which should be removed and returned
+
+ Parameters [out]:
+    -> [head], the first element of a given queue
+
+*/
+void* mpmcQueuePop(MPMCQueue* queue)
+{
+    void* head = NULL;
+    for (int i = 0; i < MPMC_QUEUE_SPIN_LIMIT; i++) {
+        if (mpmcQueueTryPop(queue, &head)) {
+            return head;
+        }
+        _mpmcQueueRelax__();
+    }
+
+    pthread_mutex_lock(&queue->park_lock);
+    atomic_fetch_add_explicit(&queue->pop_waiters, 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    while (!_mpmcQueueTryPop__(queue, &head)) {
+        pthread_cond_wait(&queue->not_empty, &queue->park_lock);
+    }
+    atomic_fetch_sub_explicit(&queue->pop_waiters, 1, memory_order_relaxed);
+    pthread_mutex_unlock(&queue->park_lock);
+
+    _mpmcQueueWake__(queue, &queue->push_waiters, &queue->not_full);
+    return head;
+}
+
+/*
+
+Getting the size of a given queue.
+> Complex time - const.
+
+* If other threads are working at the same time, the result is
+just a snapshot, which may be already outdated *
+
+ Parameters [in]:
+    -> [queue], a queue, the size of which should be returned
+
+ Parameters [out]:
+    -> [size], the size of a given queue
+
+*/
+size_t mpmcQueueSize(MPMCQueue* queue)
+{
+    size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    return tail > head ? tail - head : 0;
+}
+
+/*
+
+Checking if a given queue is empty or not.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [queue], a queue, which should be checked if it's empty or not
+
+ Parameters [out]:
+    -> [bool], the boolean result of checking if a given queue is empty or not
+
+*/
+bool mpmcQueueIsEmpty(MPMCQueue* queue)
+{
+    if (mpmcQueueSize(queue) == 0)
+        return true;
+    return false;
+}
+
+/*
+
+Clearing all memory that was allocated for the queue.
+> No thread may use the queue after that.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [queue], a queue, which should be deleted
+
+ Parameters [out]:
+    -> NULL
+*/
+void mpmcQueueDelete(MPMCQueue* queue)
+{
+    pthread_cond_destroy(&queue->not_empty);
+    pthread_cond_destroy(&queue->not_full);
+    pthread_mutex_destroy(&queue->park_lock);
+    free(queue->cells);
+    free(queue);
+}
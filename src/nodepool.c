@@ -0,0 +1,238 @@
+/*
+
+-> Node Pool collection (Base: slabs and intrusive free list) <-
+
+This software is free and can be used and modifyied by anyone
+under the terms of the GNU General Public License as
+published by the Free Software Foundation, either version 3
+of the License, or any later version.
+
+[Author] -> Stacey Kerr
+[Github] -> https://github.com/wiseStann
+
+
+-> Structure <-
+
+typedef struct NodeSlab_type {
+    struct NodeSlab_type* next;
+    max_align_t nodes[];
+} NodeSlab;
+
+typedef struct NodePool_type {
+    size_t node_size;
+    size_t align;
+    size_t slab_nodes;
+    void* free_list;
+    char* bump;
+    char* bump_end;
+    NodeSlab* slabs;
+} NodePool;
+
+ Linked containers take their nodes from a pool instead of allocating
+ every node by itself. Nodes are carved one after another out of big
+ slabs, so neighbour nodes of a container mostly stand in neighbour
+ memory. A freed node goes to the free list, which is linked through the
+ first bytes of free nodes, and is given out again by the next allocation.
+ Slabs grow twice up to [POOL_MAX_SLAB_NODES] nodes, so a small container
+ does not waste much and a big one has few slabs. The memory returns to
+ the system only when the whole pool is released, in O(slabs).
+
+ A pool with an alignment takes its slabs from [aligned_alloc] and pads
+ the slab header, so every node starts at the alignment. Containers with
+ cache-line-sized nodes use it to keep a node on as few lines as possible.
+
+
+-> Macroses <-
+
+ Check Error macroses in "include/basic.h" header file.
+ -> [_MEMORY_ALLOCATION_ERROR], a macros for notification about memory allocation error
+
+*/
+
+#include "../include/nodepool.h"
+
+
+/*
+
+Adding a new slab to a pool.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [pool], a pool, which should get a slab
+    -> [count], how many nodes the slab should hold
+
+ Parameters [out]:
+    -> [nodes], the beginning of the nodes of the new slab
+
+*/
+static char* _poolAddSlab__(NodePool* pool, size_t count)
+{
+    NodeSlab* slab;
+    size_t header = sizeof(NodeSlab);
+    if (pool->align) {
+        // The header is padded, so the first node starts at the alignment, the size must be its multiple
+        header = (header + pool->align - 1) / pool->align * pool->align;
+        slab = (NodeSlab*)aligned_alloc(pool->align, header + count * pool->node_size);
+    } else {
+        slab = (NodeSlab*)malloc(header + count * pool->node_size);
+    }
+    if (!slab) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+
+    slab->next = pool->slabs;
+    pool->slabs = slab;
+    return (char*)slab + header;
+}
+
+/*
+
+Initialization of a pool, which has no slabs yet.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [pool], a pool, which should be initialized
+    -> [node_size], the size of one node, nodes must not need a bigger alignment than pointers
+
+ Parameters [out]:
+    -> NULL
+*/
+void poolInit(NodePool* pool, size_t node_size)
+{
+    // A free node must hold the link of the free list
+    if (node_size < sizeof(void*)) {
+        node_size = sizeof(void*);
+    }
+    pool->node_size = (node_size + sizeof(void*) - 1) / sizeof(void*) * sizeof(void*);
+    pool->align = 0;
+    pool->slab_nodes = POOL_FIRST_SLAB_NODES;
+    pool->free_list = NULL;
+    pool->bump = NULL;
+    pool->bump_end = NULL;
+    pool->slabs = NULL;
+}
+
+/*
+
+Initialization of a pool, every node of which starts at a given alignment.
+> Complex time - const.
+
+* The size of node is rounded up to the alignment, so a node of exactly
+[align] bytes, e.g. of a cache line, never crosses the border of it *
+
+ Parameters [in]:
+    -> [pool], a pool, which should be initialized
+    -> [node_size], the size of one node
+    -> [align], a power of two, not less than the size of pointer
+
+ Parameters [out]:
+    -> NULL
+*/
+void poolInitAligned(NodePool* pool, size_t node_size, size_t align)
+{
+    poolInit(pool, node_size);
+    pool->node_size = (pool->node_size + align - 1) / align * align;
+    pool->align = align;
+}
+
+/*
+
+Taking a node from a pool.
+> Complex time - const.
+
+* Freed nodes are given out first, the newest one at first, then the
+unused rest of the newest slab *
+
+ Parameters [in]:
+    -> [pool], a pool, from which a node should be taken
+
+ Parameters [out]:
+    -> [node], an uninitialized node
+
+*/
+void* poolAlloc(NodePool* pool)
+{
+    if (pool->free_list) {
+        void* node = pool->free_list;
+        pool->free_list = *(void**)node;
+        return node;
+    }
+
+    if (pool->bump == pool->bump_end) {
+        pool->bump = _poolAddSlab__(pool, pool->slab_nodes);
+        pool->bump_end = pool->bump + pool->slab_nodes * pool->node_size;
+        if (pool->slab_nodes < POOL_MAX_SLAB_NODES) {
+            pool->slab_nodes *= 2;
+        }
+    }
+
+    void* node = pool->bump;
+    pool->bump += pool->node_size;
+    return node;
+}
+
+/*
+
+Taking a number of neighbour nodes from a pool at once.
+> Complex time - const.
+
+* The nodes get their own slab, which is released with the pool. Every
+one of them may be given back by [poolFree] like any other node *
+
+ Parameters [in]:
+    -> [pool], a pool, from which nodes should be taken
+    -> [count], the number of nodes, not 0
+
+ Parameters [out]:
+    -> [nodes], an array of [count] uninitialized nodes
+
+*/
+void* poolAllocBlock(NodePool* pool, size_t count)
+{
+    return _poolAddSlab__(pool, count);
+}
+
+/*
+
+Giving a node back to its pool, so it is reused by the next allocation.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [pool], a pool, from which the node was taken
+    -> [node], a node, which is not used anymore
+
+ Parameters [out]:
+    -> NULL
+*/
+void poolFree(NodePool* pool, void* node)
+{
+    *(void**)node = pool->free_list;
+    pool->free_list = node;
+}
+
+/*
+
+Freeing all nodes of a pool at once, the pool may be used again after that.
+> Complex time - O(slabs).
+
+ Parameters [in]:
+    -> [pool], a pool, which should be released
+
+ Parameters [out]:
+    -> NULL
+*/
+void poolRelease(NodePool* pool)
+{
+    NodeSlab* slab = pool->slabs;
+    while (slab) {
+        NodeSlab* next = slab->next;
+        free(slab);
+        slab = next;
+    }
+    pool->slab_nodes = POOL_FIRST_SLAB_NODES;
+    pool->free_list = NULL;
+    pool->bump = NULL;
+    pool->bump_end = NULL;
+    pool->slabs = NULL;
+}
@@ -1 +1,732 @@
+/*
 
+-> Priority Queue collection (Base: Binary Heap) <-
+
+This software is free and can be used and modifyied by anyone
+under the terms of the GNU General Public License as
+published by the Free Software Foundation, either version 3
+of the License, or any later version.
+
+[Author] -> Stacey Kerr
+[Github] -> https://github.com/wiseStann
+
+
+-> Structure <-
+
+typedef struct PriorityQueue_type {
+    size_t size;
+    size_t capacity;
+    double exp_val;
+    PQCompare cmp;
+    void* ctx;
+    void **buff;
+    PQHandle *handles;
+    size_t *positions;
+    size_t handles_count;
+    PQHandle free_handle;
+} PriorityQueue;
+
+ The buffer keeps a binary heap: the children of the element standing at
+ [i] are standing at [2i + 1] and [2i + 2], and no child goes before its
+ parent according to the comparator. So the element with the highest
+ priority is always standing at [0].
+
+ Every element gets a handle when it is pushed. [handles] keeps the handle
+ of the element standing at the same position of the heap, and [positions]
+ maps a handle back to the position, so both are updated every time an
+ element moves. Handles of removed elements are chained into a free list
+ through [positions] and are given out again by next pushes.
+
+
+-> Macroses <-
+
+ Check Error macroses in "include/basic.h" header file.
+ -> [_EMPTY_QUEUE_ERROR], a macros for notification about empty given queue
+ -> [_MEMORY_ALLOCATION_ERROR], a macros for notification about memory allocation error
+ -> [_VALUE_ERROR], a macros for notification about handle, which is not in queue
+
+*/
+
+#include "../include/priorityqueue.h"
+
+
+/*
+
+Comparing two elements of a given queue.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [pq], a queue, the comparator of which should be used
+    -> [a], [b], elements, which should be compared
+
+ Parameters [out]:
+    -> [int], less than 0 if [a] should be popped before [b]
+
+*/
+static inline int _pqCompare__(PriorityQueue* pq, void* a, void* b)
+{
+    if (pq->cmp) {
+        return pq->cmp(a, b, pq->ctx);
+    }
+    return (a > b) - (a < b);
+}
+
+/*
+
+Putting an element with a given handle at a specific position of the heap.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [pq], a queue, the heap of which should be changed
+    -> [index], a position, at which the element should be put
+    -> [item], [handle], the element and its handle
+
+ Parameters [out]:
+    -> NULL
+*/
+static inline void _pqPlace__(PriorityQueue* pq, size_t index, void* item, PQHandle handle)
+{
+    pq->buff[index] = item;
+    pq->handles[index] = handle;
+    pq->positions[handle] = index;
+}
+
+/*
+
+Moving an element up to its place in the heap.
+> Complex time - O(log(n)).
+
+* The element is not swapped on every level, the parents are just moved
+down into the hole, and the element is written once at the end *
+
+ Parameters [in]:
+    -> [pq], a queue, the heap of which should be fixed
+    -> [index], a position of the element, which should be moved up
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _pqSiftUp__(PriorityQueue* pq, size_t index)
+{
+    void* item = pq->buff[index];
+    PQHandle handle = pq->handles[index];
+
+    while (index > 0) {
+        size_t parent = (index - 1) / 2;
+        if (_pqCompare__(pq, item, pq->buff[parent]) >= 0) {
+            break;
+        }
+        _pqPlace__(pq, index, pq->buff[parent], pq->handles[parent]);
+        index = parent;
+    }
+    _pqPlace__(pq, index, item, handle);
+}
+
+/*
+
+Moving an element down to its place in the heap.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [pq], a queue, the heap of which should be fixed
+    -> [index], a position of the element, which should be moved down
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _pqSiftDown__(PriorityQueue* pq, size_t index)
+{
+    void* item = pq->buff[index];
+    PQHandle handle = pq->handles[index];
+    size_t half = pq->size / 2;
+
+    while (index < half) {
+        size_t child = 2 * index + 1;
+        if (child + 1 < pq->size && _pqCompare__(pq, pq->buff[child + 1], pq->buff[child]) < 0) {
+            child++;
+        }
+        if (_pqCompare__(pq, pq->buff[child], item) >= 0) {
+            break;
+        }
+        _pqPlace__(pq, index, pq->buff[child], pq->handles[child]);
+        index = child;
+    }
+    _pqPlace__(pq, index, item, handle);
+}
+
+/*
+
+Moving an element, which was just replaced, to its place in the heap.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [pq], a queue, the heap of which should be fixed
+    -> [index], a position of the element, which should be moved
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _pqFix__(PriorityQueue* pq, size_t index)
+{
+    if (index > 0 && _pqCompare__(pq, pq->buff[index], pq->buff[(index - 1) / 2]) < 0) {
+        _pqSiftUp__(pq, index);
+    } else {
+        _pqSiftDown__(pq, index);
+    }
+}
+
+/*
+
+Getting a handle for a new element.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [pq], a queue, which gives out the handle
+
+ Parameters [out]:
+    -> [handle], a free handle
+
+*/
+static PQHandle _pqTakeHandle__(PriorityQueue* pq)
+{
+    if (pq->free_handle != PQ_INVALID_HANDLE) {
+        PQHandle handle = pq->free_handle;
+        pq->free_handle = pq->positions[handle];
+        return handle;
+    }
+    return pq->handles_count++;
+}
+
+/*
+
+Appending an element to the end of the heap without fixing it.
+> Capacity of the queue must be already big enough.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [pq], a queue, to the heap of which an item should be appended
+    -> [item], an item, which should be appended
+
+ Parameters [out]:
+    -> [handle], the handle of the appended item
+
+*/
+static PQHandle _pqAppend__(PriorityQueue* pq, void* item)
+{
+    PQHandle handle = _pqTakeHandle__(pq);
+    _pqPlace__(pq, pq->size, item, handle);
+    pq->size++;
+    return handle;
+}
+
+/*
+
+Remove and getting the element standing at a specific position of the heap.
+> Index must be within the bounds of the heap.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [pq], a queue, the element of which should be removed
+    -> [index], a position of the element
+
+ Parameters [out]:
+    -> [item], the removed element
+
+*/
+static void* _pqRemoveAt__(PriorityQueue* pq, size_t index)
+{
+    void* item = pq->buff[index];
+    PQHandle handle = pq->handles[index];
+
+    // The handle goes to the free list
+    pq->positions[handle] = pq->free_handle;
+    pq->free_handle = handle;
+
+    pq->size--;
+    if (index < pq->size) {
+        _pqPlace__(pq, index, pq->buff[pq->size], pq->handles[pq->size]);
+        _pqFix__(pq, index);
+    }
+    return item;
+}
+
+/*
+
+Building the heap from the elements in an arbitrary order.
+> Complex time - O(n).
+
+* Bottom-up heapify: every inner node starting from the last one is moved
+down, most of the nodes are near the leaves, so the total work is linear *
+
+ Parameters [in]:
+    -> [pq], a queue, the buffer of which should be turned into the heap
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _pqHeapify__(PriorityQueue* pq)
+{
+    for (size_t i = pq->size / 2; i > 0; i--) {
+        _pqSiftDown__(pq, i - 1);
+    }
+}
+
+/*
+
+Creating a new priority queue.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [cmp], a comparator of elements, if it is NULL the smallest raw value goes first
+    -> [ctx], user data, which is passed to every call of the comparator
+
+ Parameters [out]:
+    -> [pq], a new created priority queue
+
+*/
+PriorityQueue* pqNew(PQCompare cmp, void* ctx)
+{
+    PriorityQueue* pq = (PriorityQueue*)malloc(sizeof(PriorityQueue));
+    if (!pq) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+
+    pq->size = 0;
+    pq->capacity = STANDARD_CAPACITY;
+    pq->exp_val = STANDARD_EXPANSION_VAL;
+    pq->cmp = cmp;
+    pq->ctx = ctx;
+    pq->handles_count = 0;
+    pq->free_handle = PQ_INVALID_HANDLE;
+    pq->buff = malloc(pq->capacity * sizeof(void*));
+    pq->handles = malloc(pq->capacity * sizeof(PQHandle));
+    pq->positions = malloc(pq->capacity * sizeof(size_t));
+    if (!pq->buff || !pq->handles || !pq->positions) {
+        free(pq->buff);
+        free(pq->handles);
+        free(pq->positions);
+        free(pq);
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+
+    return pq;
+}
+
+/*
+
+Making a priority queue using a given array.
+> Complex time - O(n).
+
+* The elements are copied, so a given array stays untouched *
+
+ Parameters [in]:
+    -> [array], an array, the elements of which should be put in the queue
+    -> [cmp], a comparator of elements
+    -> [ctx], user data, which is passed to every call of the comparator
+
+ Parameters [out]:
+    -> [pq], a made queue using a given array
+
+*/
+PriorityQueue* pqFromArray(Array* array, PQCompare cmp, void* ctx)
+{
+    PriorityQueue* pq = pqNew(cmp, ctx);
+
+    pqReserve(pq, array->size);
+    for (size_t i = 0; i < array->size; i++) {
+        _pqAppend__(pq, array->buff[i]);
+    }
+    _pqHeapify__(pq);
+
+    return pq;
+}
+
+/*
+
+Appending an element to a given queue.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [pq], a queue, to which an item should be appended
+    -> [item], an item, which should be appended to a given queue
+
+ Parameters [out]:
+    -> [handle], the handle of the appended item
+
+*/
+PQHandle pqPush(PriorityQueue* pq, void* item)
+{
+    if (pq->size >= pq->capacity) {
+        size_t temp_cap = pq->capacity * pq->exp_val;
+        pqReserve(pq, temp_cap > pq->capacity ? temp_cap : pq->capacity + 1);
+    }
+
+    PQHandle handle = _pqAppend__(pq, item);
+    _pqSiftUp__(pq, pq->size - 1);
+    return handle;
+}
+
+/*
+
+Appending a batch of elements to a given queue.
+> Complex time - O(min(k * log(n + k), n + k)).
+
+* If the batch is bigger than the queue itself, it is cheaper to
+append all the elements and rebuild the heap in linear time *
+
+ Parameters [in]:
+    -> [pq], a queue, to which items should be appended
+    -> [items], an array of items, which should be appended
+    -> [count], the size of a given array
+
+ Parameters [out]:
+    -> NULL
+*/
+void pqPushN(PriorityQueue* pq, void** items, size_t count)
+{
+    pqReserve(pq, pq->size + count);
+
+    if (count > pq->size) {
+        for (size_t i = 0; i < count; i++) {
+            _pqAppend__(pq, items[i]);
+        }
+        _pqHeapify__(pq);
+    } else {
+        for (size_t i = 0; i < count; i++) {
+            _pqAppend__(pq, items[i]);
+            _pqSiftUp__(pq, pq->size - 1);
+        }
+    }
+}
+
+/*
+
+Remove and getting the element with the highest priority.
+> Given queue must not be empty.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [pq], a queue, the top of which should be removed and returned
+
+ Parameters [out]:
+    -> [top], the element with the highest priority
+
+*/
+void* pqPop(PriorityQueue* pq)
+{
+    if (pq->size == 0) {
+        _EMPTY_QUEUE_ERROR;
+        return NULL;
+    }
+
+    void* top = _pqRemoveAt__(pq, 0);
+    return top;
+}
+
+/*
+
+Getting the element with the highest priority.
+> Given queue must not be empty.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [pq], a queue, the top of which should be returned
+
+ Parameters [out]:
+    -> [top], the element with the highest priority
+
+*/
+void* pqPeek(PriorityQueue* pq)
+{
+    if (pq->size == 0) {
+        _EMPTY_QUEUE_ERROR;
+        return NULL;
+    }
+
+    void* top = pq->buff[0];
+    return top;
+}
+
+/*
+
+Getting the handle of the element with the highest priority.
+> Given queue must not be empty.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [pq], a queue, the handle of the top of which should be returned
+
+ Parameters [out]:
+    -> [handle], the handle of the element with the highest priority
+
+*/
+PQHandle pqPeekHandle(PriorityQueue* pq)
+{
+    if (pq->size == 0) {
+        _EMPTY_QUEUE_ERROR;
+        return PQ_INVALID_HANDLE;
+    }
+
+    PQHandle handle = pq->handles[0];
+    return handle;
+}
+
+/*
+
+Checking if a given handle belongs to an element of a given queue.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [pq], a queue, which should be checked
+    -> [handle], a handle, which should be checked
+
+ Parameters [out]:
+    -> [bool], the result of checking
+
+*/
+bool pqContainsHandle(PriorityQueue* pq, PQHandle handle)
+{
+    if (handle >= pq->handles_count)
+        return false;
+
+    size_t index = pq->positions[handle];
+    if (index < pq->size && pq->handles[index] == handle)
+        return true;
+    return false;
+}
+
+/*
+
+Getting the element with a given handle.
+> Handle must belong to an element of the queue.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [pq], a queue, the element of which should be returned
+    -> [handle], the handle of the element
+
+ Parameters [out]:
+    -> [item], the element with a given handle
+
+*/
+void* pqGetByHandle(PriorityQueue* pq, PQHandle handle)
+{
+    if (!pqContainsHandle(pq, handle)) {
+        _VALUE_ERROR;
+        return NULL;
+    }
+
+    void* item = pq->buff[pq->positions[handle]];
+    return item;
+}
+
+/*
+
+Replacing the element with a given handle by one with the same or higher priority.
+> Handle must belong to an element of the queue.
+> Complex time - O(log(n)).
+
+* The handle stays the same, the new element is only moved up *
+
+ Parameters [in]:
+    -> [pq], a queue, the element of which should be replaced
+    -> [handle], the handle of the element
+    -> [item], a new element
+
+ Parameters [out]:
+    -> NULL
+*/
+void pqDecreaseKey(PriorityQueue* pq, PQHandle handle, void* item)
+{
+    if (!pqContainsHandle(pq, handle)) {
+        _VALUE_ERROR;
+        return;
+    }
+
+    size_t index = pq->positions[handle];
+    if (_pqCompare__(pq, item, pq->buff[index]) > 0) {
+        panic("in '%s': given element has lower priority than the old one", __FUNCTION__);
+        return;
+    }
+
+    pq->buff[index] = item;
+    _pqSiftUp__(pq, index);
+}
+
+/*
+
+Replacing the element with a given handle by one with the same or lower priority.
+> Handle must belong to an element of the queue.
+> Complex time - O(log(n)).
+
+* The handle stays the same, the new element is only moved down *
+
+ Parameters [in]:
+    -> [pq], a queue, the element of which should be replaced
+    -> [handle], the handle of the element
+    -> [item], a new element
+
+ Parameters [out]:
+    -> NULL
+*/
+void pqIncreaseKey(PriorityQueue* pq, PQHandle handle, void* item)
+{
+    if (!pqContainsHandle(pq, handle)) {
+        _VALUE_ERROR;
+        return;
+    }
+
+    size_t index = pq->positions[handle];
+    if (_pqCompare__(pq, item, pq->buff[index]) < 0) {
+        panic("in '%s': given element has higher priority than the old one", __FUNCTION__);
+        return;
+    }
+
+    pq->buff[index] = item;
+    _pqSiftDown__(pq, index);
+}
+
+/*
+
+Replacing the element with a given handle by any other one.
+> Handle must belong to an element of the queue.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [pq], a queue, the element of which should be replaced
+    -> [handle], the handle of the element
+    -> [item], a new element
+
+ Parameters [out]:
+    -> NULL
+*/
+void pqUpdate(PriorityQueue* pq, PQHandle handle, void* item)
+{
+    if (!pqContainsHandle(pq, handle)) {
+        _VALUE_ERROR;
+        return;
+    }
+
+    size_t index = pq->positions[handle];
+    pq->buff[index] = item;
+    _pqFix__(pq, index);
+}
+
+/*
+
+Remove and getting the element with a given handle.
+> Handle must belong to an element of the queue.
+> Complex time - O(log(n)).
+
+ Parameters [in]:
+    -> [pq], a queue, the element of which should be removed
+    -> [handle], the handle of the element
+
+ Parameters [out]:
+    -> [item], the removed element
+
+*/
+void* pqRemove(PriorityQueue* pq, PQHandle handle)
+{
+    if (!pqContainsHandle(pq, handle)) {
+        _VALUE_ERROR;
+        return NULL;
+    }
+
+    void* item = _pqRemoveAt__(pq, pq->positions[handle]);
+    return item;
+}
+
+/*
+
+Checking if a given queue is empty or not.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [pq], a queue, which should be checked if it's empty or not
+
+ Parameters [out]:
+    -> [bool], the boolean result of checking if a given queue is empty or not
+
+*/
+bool pqIsEmpty(PriorityQueue* pq)
+{
+    if (pq->size == 0)
+        return true;
+    return false;
+}
+
+/*
+
+Reserving the capacity of a given queue.
+> Complex time - most likely O(n).
+
+* Nothing happens if the queue can already keep a given number of elements *
+
+ Parameters [in]:
+    -> [pq], a queue, the capacity of which should be expanded
+    -> [capacity], the number of elements the queue should be able to keep
+
+ Parameters [out]:
+    -> NULL
+*/
+void pqReserve(PriorityQueue* pq, size_t capacity)
+{
+    if (capacity <= pq->capacity) {
+        return;
+    } else if (capacity > MAXSIZE) {
+        panic("'%s':%d: max capacity size exceeded", __FUNCTION__, __LINE__);
+        exit(1);
+    }
+
+    void** buff = realloc(pq->buff, capacity * sizeof(void*));
+    PQHandle* handles = buff ? realloc(pq->handles, capacity * sizeof(PQHandle)) : NULL;
+    size_t* positions = handles ? realloc(pq->positions, capacity * sizeof(size_t)) : NULL;
+    if (!positions) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+    pq->buff = buff;
+    pq->handles = handles;
+    pq->positions = positions;
+    pq->capacity = capacity;
+}
+
+/*
+
+Clearing a given queue without deleting allocated memory.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [pq], a queue, which should be cleared
+
+ Parameters [out]:
+    -> NULL
+*/
+void pqClear(PriorityQueue* pq)
+{
+    pq->size = 0;
+    pq->handles_count = 0;
+    pq->free_handle = PQ_INVALID_HANDLE;
+}
+
+/*
+
+Clearing all memory that was allocated for the queue.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [pq], a queue, which should be deleted
+
+ Parameters [out]:
+    -> NULL
+*/
+void pqDelete(PriorityQueue* pq)
+{
+    free(pq->buff);
+    free(pq->handles);
+    free(pq->positions);
+    free(pq);
+}
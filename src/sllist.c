@@ -39,6 +39,7 @@ A short description of all:
 */
 
 #include "../include/sllist.h"
+#include "../include/list_sortings.h"
 
 /*
 
@@ -63,12 +64,14 @@ List* listNew()
     list->size = 0;
     list->head = NULL;
     list->tail = NULL;
+    poolInit(&list->pool, sizeof(Node));
     return list;
 }
 
 /*
 
 New node creation.
+> The node is allocated by itself and does not belong to any list.
 > Complex time - const.
 
  Parameters [in]:
@@ -97,8 +100,29 @@ Node* nodeNew(void* value)
 
 /*
 
+New node creation from the pool of a given list.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [list], a list, which the node will belong to
+    -> [value], a value, which should be the data of new node
+
+ Parameters [out]:
+    -> [node], a new created node
+
+*/
+static Node* _listNodeNew__(List* list, void* value)
+{
+    Node* node = (Node*)poolAlloc(&list->pool);
+    node->data = value;
+    node->next = NULL;
+    return node;
+}
+
+/*
+
 Appending a given element to the end of the list.
-> Complex time - O(n).
+> Complex time - const.
 
  Parameters [in]:
     -> [list], a list, to the end of which the element should be appended
@@ -108,35 +132,26 @@ Appending a given element to the end of the list.
     -> NULL
 */
 void listPush(List* list, void* value)
-{   
+{
     /*  If the list is absolutely empty, we create the head.
-       Also we assign the value of the head to the tail */ 
+       Also we assign the value of the head to the tail */
+    Node* new_node = _listNodeNew__(list, value);
     if (!list->head) {
-        list->head = nodeNew(value);
-        list->tail = list->head;
+        list->head = new_node;
     } else {
-    /*  Because we want to append an item to the end of the list, we
-     * have to traverse it to the end.
-     */ 
-        Node* curr_node = list->head;
-        while (curr_node->next) {
-            curr_node = curr_node->next;
-        }
-        
-    /*  Now we create a new node, assign it to the tail of the list
-     * and connect the last one to the new tail.
+    /*  The list keeps its tail, so we just connect the last node
+     * to the new one and make it the new tail.
      *
      *   head             tail          |new node|
      *  | 1 | -> | 2 | -> | 3 | -> NULL     v
      *
      */
-        list->tail = nodeNew(value);
-        curr_node->next = list->tail;
+        list->tail->next = new_node;
     }
+    list->tail = new_node;
     /*  Now our list looks like that:
      *  | 1 | -> | 2 | -> | 3 | -> |new node| -> NULL
      */
-    
     list->size++;
 }
 
@@ -161,7 +176,7 @@ void listPrepend(List* list, void* value)
      *      V      | 1 | -> | 2 | -> | 3 | -> | 4 | -> | 5 | -> | 6 |
      *
      */
-    Node* new_node = nodeNew(value);
+    Node* new_node = _listNodeNew__(list, value);
     if (!list->head) {
         list->head = new_node;
         list->tail = list->head;
@@ -202,6 +217,9 @@ void listInsert(List* list, void* value, size_t index)
         _EMPTY_LIST_ERROR;
     } else if (index > list->size) {
         _INDEX_ERROR(index);
+    // Inserting after the tail is just appending
+    } else if (index == list->size) {
+        listPush(list, value);
     } else {
         
         /*  We start the counter and increment it every time. When the counter
@@ -221,7 +239,7 @@ void listInsert(List* list, void* value, size_t index)
          * and a new one connect to the right node (in out case 4).
          */
         size_t curr_index = 1;
-        Node* new_node = nodeNew(value);
+        Node* new_node = _listNodeNew__(list, value);
         Node* curr_node = list->head;
         while (curr_node) {
             Node* next_node = curr_node->next;
@@ -257,16 +275,17 @@ void listRemoveEnd(List* list)
     if (!list->head) {
         _EMPTY_LIST_ERROR; return;
     } else if (!list->head->next) {
-        free(list->head);
+        poolFree(&list->pool, list->head);
         list->head = NULL;
+        list->tail = NULL;
     } else {
-        // Traverse the list to the end
+        // The node before the tail is unknown in a singly linked list, so traverse the list to the end
         Node* curr_node = list->head;
         while (curr_node->next->next) {
             curr_node = curr_node->next;
         }
         // Free the last node, i.e. clear allocated memory
-        free(curr_node->next);
+        poolFree(&list->pool, curr_node->next);
         // Equate this node to NULL, in order to make right border of list
         curr_node->next = NULL;
         list->tail = curr_node;
@@ -303,8 +322,11 @@ void listRemoveBegin(List* list)
          * the head of list, so now the head of list is the second node in initial list.
          */
         Node* next_node = list->head->next;
-        free(list->head);
+        poolFree(&list->pool, list->head);
         list->head = next_node;
+        if (!next_node) {
+            list->tail = NULL;
+        }
     }
     list->size--;
 }
@@ -352,6 +374,8 @@ void listRemoveAt(List* list, size_t index)
         while (curr_node) {
             if (curr_index == index) {
                 last_node->next = curr_node->next;
+                poolFree(&list->pool, curr_node);
+                break;
             }
             last_node = curr_node;
             curr_node = curr_node->next;
@@ -398,10 +422,14 @@ void listRemoveFirst(List* list, void* value)
          *     | 1 | -> | 2 | -> | 3 | -> | 4 | -> | 6 | -> | 7 | -> NULL
          */
         Node* curr_node = list->head;
-        Node* last_node;
+        Node* last_node = NULL;
         while (curr_node) {
             if (curr_node->data == value) {
                 last_node->next = curr_node->next;
+                if (curr_node == list->tail) {
+                    list->tail = last_node;
+                }
+                poolFree(&list->pool, curr_node);
                 break;
             }
             last_node = curr_node;
@@ -441,7 +469,7 @@ void listRemoveLast(List* list, void* value)
          */
         size_t curr_index = 0;
         Node* curr_node = list->head;
-        size_t last_index;
+        size_t last_index = 0;
         while (curr_node) {
             if (curr_node->data == value) {
                 last_index = curr_index;
@@ -484,11 +512,13 @@ void listRemoveAll(List* list, void* value)
         size_t curr_index = 0;
         Node* curr_node = list->head;
         while (curr_node) {
+            // The node is freed by 'listRemoveAt', so the next one is taken beforehand
+            Node* next_node = curr_node->next;
             if (curr_node->data == value) {
                 listRemoveAt(list, curr_index);
                 curr_index--;
             }
-            curr_node = curr_node->next;
+            curr_node = next_node;
             curr_index++;
         }
     }
@@ -516,6 +546,8 @@ void listReverseMut(List* list)
      *   Check out this video for detailed explanation:
      *   https://www.youtube.com/watch?v=O0By4Zq0OFc
      */
+    // The head becomes the tail after reversing
+    list->tail = list->head;
     Node* curr_node = list->head; 
     Node* next = NULL;
     Node* prev = NULL;
@@ -773,7 +805,11 @@ List* listShallCopy(List* list)
 /*
 
 Making and return a deep copy of a given list.
-> Complex time - const.
+> Complex time - O(n).
+
+* Every node is copied into a node of the new list, so the copies share
+no nodes and each one may be changed or deleted alone. The elements are
+not owned by a list, so both lists point to the same elements *
 
  Parameters [in]:
     -> [list], a list, a deep copy of which should be returned
@@ -784,18 +820,12 @@ Making and return a deep copy of a given list.
 */
 List* listDeepCopy(List* list)
 {
-    if (!list->head) {
-        return list;
-    }
-
     List* copied_list = listNew();
-    
-    /*  Here we directly assign the head node of a given list
-     * to the head of a new one, that's why all changes in the new list
-     * will affect the old one.
-     */
-    copied_list->head = list->head;
-    copied_list->size = list->size;
+    Node* curr_node = list->head;
+    while (curr_node) {
+        listPush(copied_list, curr_node->data);
+        curr_node = curr_node->next;
+    }
     return copied_list;
 }
 
@@ -1082,19 +1112,13 @@ Extending a given list by another one.
 */
 void listExtend(List* f_list, List* s_list)
 {
-    if (!f_list->head) {
-        List* temp = listShallCopy(s_list);
-        f_list->head = temp->head;
-        f_list->size = temp->size;
-    } else {
-        /*  Appending nodes from the second list to the first list
-         * thereby extending the first one.
-         */
-        Node* s_list_node = s_list->head;
-        while (s_list_node) {
-            listPush(f_list, s_list_node->data);
-            s_list_node = s_list_node->next;
-        }
+    /*  Appending nodes from the second list to the first list
+     * thereby extending the first one, every append is const.
+     */
+    Node* s_list_node = s_list->head;
+    while (s_list_node) {
+        listPush(f_list, s_list_node->data);
+        s_list_node = s_list_node->next;
     }
 }
 
@@ -1115,37 +1139,47 @@ void swapLists(List* f_list, List* s_list)
     Node* temp_head = f_list->head;
     Node* temp_tail = f_list->tail;
     size_t temp_size = f_list->size;
+    NodePool temp_pool = f_list->pool;
     
-    // Just swap the head nodes of two lists.
+    // Just swap the head nodes of two lists, the nodes go with their pools.
     f_list->head = s_list->head;
     f_list->tail = s_list->tail;
     f_list->size = s_list->size;
+    f_list->pool = s_list->pool;
 
     s_list->head = temp_head;
     s_list->tail = temp_tail;
     s_list->size = temp_size;
+    s_list->pool = temp_pool;
 }
 
 /*
 
 Sorting a given list 'in-place', i.e. the list is mutable.
 > Type of a given data structure must be List.
-> Complex time - depending on what kind of sorting algorithm is used here.
+> Complex time - depending on what kind of sorting algorithm is used here,
+O(n*log(n)) for the default merge sort.
 
  Parameters [in]:
     -> [list], a list, which should be sorted by a given function
-    -> [func], a function, which should sort a given list
+    -> [func], a function, which should sort a given list, if it is NULL merge sort is used
+    -> [cmp], a comparator of elements, if it is NULL the raw values are compared
+    -> [ctx], a pointer, which is passed to every call of [cmp]
 
  Parameters [out]:
     -> NULL
 */
-void listSortMut(List* list, List*(*func)(List*))
+void listSortMut(List* list, ListSortFunc func, ListCompare cmp, void* ctx)
 {
     if (!list->head) {
         _EMPTY_LIST_ERROR;
+        return;
     }
-    
-    func(list);
+
+    if (!func) {
+        func = listMergeSort;
+    }
+    func(list, cmp, ctx);
 }
 
 /*
@@ -1157,13 +1191,15 @@ Creating a copy of a given list, sorting it and return.
 
  Parameters [in]:
     -> [list], a list, a copy of which sould be sorted
-    -> [func], a function, which should sort a given list
+    -> [func], a function, which should sort a given list, if it is NULL merge sort is used
+    -> [cmp], a comparator of elements, if it is NULL the raw values are compared
+    -> [ctx], a pointer, which is passed to every call of [cmp]
 
  Parameters [out]:
     -> [new_list], a sorted copy of given list
 
 */
-List* listSortNew(List* list, List*(*func)(List*))
+List* listSortNew(List* list, ListSortFunc func, ListCompare cmp, void* ctx)
 {
     if (!list->head) {
         _EMPTY_LIST_ERROR;
@@ -1172,7 +1208,7 @@ List* listSortNew(List* list, List*(*func)(List*))
 
     // Create a shallow copy of a give list
     List* sorted_list = listShallCopy(list);
-    func(sorted_list);
+    listSortMut(sorted_list, func, cmp, ctx);
 
     return sorted_list;
 }
@@ -1207,8 +1243,7 @@ void listClear(List* list)
 /*
 
 Clearing a given list with deleting allocated memory, actually remove.
-> Given list must not be empty.
-> Complex time - O(n).
+> Complex time - O(slabs), all nodes are freed together with the slabs of the pool.
 
  Parameters [in]:
     -> [list], a list, which should be removed
@@ -1218,18 +1253,7 @@ Clearing a given list with deleting allocated memory, actually remove.
 */
 void listDelete(List* list)
 {
-    if (!list->head) {
-        panic("%s:%d: cannot remove empty list", __FILE__, __LINE__);
-        exit(1);   
-    }
-
-    Node* curr_node = list->head;
-    Node* next;
-    while (curr_node) {
-        next = curr_node->next;
-        free(curr_node);
-        curr_node = next;
-    }
+    poolRelease(&list->pool);
     list->head = NULL;
     list->tail = NULL;
     list->size = 0;
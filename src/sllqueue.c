@@ -68,6 +68,7 @@ New queue creation.
     queue->size = 0;
     queue->front = NULL;
     queue->back = NULL;
+    poolInit(&queue->pool, sizeof(Node));
     return queue;
 }
 
@@ -96,7 +97,8 @@ Making a queue from a given array.
 /*
 
 New node creation.
-> Complex time - O(n).
+> The node is allocated by itself and does not belong to any queue.
+> Complex time - const.
 
  Parameters [in]:
     -> [value], a value, which should be the data of new node
@@ -119,8 +121,29 @@ New node creation.
 
 /*
 
+New node creation from the pool of a given queue.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [queue], a queue, which the node will belong to
+    -> [value], a value, which should be the value of new node
+
+ Parameters [out]:
+    -> [node], a new created node
+
+*/
+static Node* _queueNodeNew__(Queue* queue, void* value)
+{
+    Node* node = (Node*)poolAlloc(&queue->pool);
+    node->value = value;
+    node->next = NULL;
+    return node;
+}
+
+/*
+
 Appending new element to the end of a given queue.
-> Complex time - O(n).
+> Complex time - const.
 
  Parameters [in]:
     -> [queue], a queue, to which an element should be appended
@@ -130,20 +153,18 @@ Appending new element to the end of a given queue.
 */
 void enqueue(Queue* queue, void* item)
 {
-    if (!queue->front) {
-        queue->front = qnodeNew(item);
-        queue->back = queue->front;
-    } else if (queue->size == MAXSIZE) {
+    if (queue->size == MAXSIZE) {
         panic("%s:%d: max size of elements is reached", __FILE__, __LINE__);
         exit(1);
+    }
+
+    Node* new_node = _queueNodeNew__(queue, item);
+    if (!queue->front) {
+        queue->front = new_node;
     } else {
-        Node* curr_node = queue->front;
-        while (curr_node->next) {
-            curr_node = curr_node->next;
-        }
-        curr_node->next = qnodeNew(item);
-        queue->back = curr_node->next;
+        queue->back->next = new_node;
     }
+    queue->back = new_node;
     queue->size++;
 }
 
@@ -167,8 +188,13 @@ void* dequeue(Queue* queue)
         return NULL;
     }
 
-    void* front = queue->front->value;
-    queue->front = queue->front->next;
+    Node* front_node = queue->front;
+    void* front = front_node->value;
+    queue->front = front_node->next;
+    if (!queue->front) {
+        queue->back = NULL;
+    }
+    poolFree(&queue->pool, front_node);
     queue->size--;
     return front;
 }
@@ -316,13 +342,14 @@ Clearing a given queue without deleting allocated memory.
         queue->front = queue->front->next;
     }
     queue->front = NULL;
+    queue->back = NULL;
     queue->size = 0;
 }
 
 /*
 
-Clearing all memory that was allocated for the queue.
-> Complex time - O(n).
+Clearing all memory that was allocated for the nodes of the queue.
+> Complex time - O(slabs), all nodes are freed together with the slabs of the pool.
 
  Parameters [in]:
     -> [queue], a queue, which should be deleted
@@ -332,18 +359,8 @@ Clearing all memory that was allocated for the queue.
 */
  void queueDelete(Queue* queue)
 {
-    if (!queue->front) {
-        panic("%s:%d: cannot remove empty queue", __FILE__, __LINE__);
-        exit(1);   
-    }
-
-    Node* curr_node = queue->front;
-    Node* next;
-    while (curr_node) {
-        next = curr_node->next;
-        free(curr_node);
-        curr_node = next;
-    }
+    poolRelease(&queue->pool);
     queue->front = NULL;
+    queue->back = NULL;
     queue->size = 0;
 }
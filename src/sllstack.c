@@ -70,6 +70,7 @@ New stack creation.
     stack->size = 0;
     stack->head = NULL;
     stack->tail = NULL;
+    poolInit(&stack->pool, sizeof(Node));
     return stack;
 }
 
@@ -98,7 +99,8 @@ Making a stack from a given array.
 /*
 
 New node creation.
-> Complex time - O(n).
+> The node is allocated by itself and does not belong to any stack.
+> Complex time - const.
 
  Parameters [in]:
     -> [value], a value, which should be the data of new node
@@ -123,46 +125,66 @@ New node creation.
 
 /*
 
-Appending new element to the end of a given stack.
-> Complex time - O(n).
+New node creation from the pool of a given stack.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [stack], a stack, which the node will belong to
+    -> [value], a value, which should be the data of new node
+
+ Parameters [out]:
+    -> [node], a new created node
+
+*/
+static Node* _stackNodeNew__(Stack* stack, void* value)
+{
+    Node* new_node = (Node*)poolAlloc(&stack->pool);
+    new_node->data = value;
+    new_node->next = NULL;
+    return new_node;
+}
+
+/*
+
+Pushing new element on the top of a given stack.
+> Complex time - const.
+
+* The top of stack is the head of its list, so both push and pop only
+touch the head. The tail is the bottom, i.e. the first pushed element *
 
  Parameters [in]:
-    -> [stack], a stack, to which an element should be appended
-    -> [value], a value, which should be appended to the stack
+    -> [stack], a stack, to which an element should be pushed
+    -> [value], a value, which should be pushed on the stack
  Parameters [out]:
     -> NULL
 */
 void stackPush(Stack* stack, void* value)
 {
-    if (!stack->head) {
-        stack->head = snodeNew(value);
-        stack->tail = stack->head;
-    } else if (stack->size >= MAXSIZE) {
+    if (stack->size >= MAXSIZE) {
         panic("%s:%d: max size of elements is reached", __FILE__, __LINE__);
         exit(1);
-    } else {
-        Node* curr_node = stack->head;
-        while (curr_node->next) {
-            curr_node = curr_node->next;
-        }
-
-        curr_node->next = snodeNew(value);
-        stack->tail = curr_node->next;
+    }
+
+    Node* new_node = _stackNodeNew__(stack, value);
+    new_node->next = stack->head;
+    stack->head = new_node;
+    if (!stack->tail) {
+        stack->tail = new_node;
     }
     stack->size++;
 }
 
 /*
 
-Remove and return the tail of a given stack.
+Remove and return the top of a given stack.
 > Given stack must not be empty.
 > Complex time - const.
 
  Parameters [in]:
-    -> [stack], a stack, from which the tail should be removed and returned
+    -> [stack], a stack, from which the top should be removed and returned
 
  Parameters [out]:
-    -> [tail], the first element of stack, which should be removed and returned
+    -> [top], the last pushed element of stack, which should be removed and returned
 
 */
 void* stackPop(Stack* stack)
@@ -172,22 +194,21 @@ void* stackPop(Stack* stack)
         return NULL;
     }
 
-    void* tail = stack->tail->data;
-
-    Node* curr_node = stack->head;
-    while (curr_node->next->next) {
-        curr_node = curr_node->next;
+    Node* top_node = stack->head;
+    void* top = top_node->data;
+    stack->head = top_node->next;
+    if (!stack->head) {
+        stack->tail = NULL;
     }
-    free(curr_node->next);
-    curr_node->next = NULL;
+    poolFree(&stack->pool, top_node);
     stack->size--;
-    
-    return tail;
+
+    return top;
 }
 
 /*
 
-Getting the top element of a given stack.
+Getting the top element of a given stack, i.e. the last pushed one.
 > Given stack must not be empty.
 > Complex time - const.
 
@@ -210,7 +231,7 @@ void* stackTop(Stack* stack)
 
 /*
 
-Getting the tail of a given stack.
+Getting the tail of a given stack, i.e. the bottom element, which was pushed first.
 > Given stack must not be empty.
 > Complex time - const.
 
@@ -329,12 +350,13 @@ Clearing a given stack without deleting allocated memory.
     }
     stack->head = NULL;
     stack->tail = 0;
+    stack->size = 0;
 }
 
 /*
 
-Clearing all memory that was allocated for the stack.
-> Complex time - O(n).
+Clearing all memory that was allocated for the nodes of the stack.
+> Complex time - O(slabs), all nodes are freed together with the slabs of the pool.
 
  Parameters [in]:
     -> [stack], a stack, which should be deleted
@@ -344,18 +366,8 @@ Clearing all memory that was allocated for the stack.
 */
  void stackDelete(Stack* stack)
 {
-    if (!stack->head) {
-        panic("%s:%d: cannot remove empty stack", __FILE__, __LINE__);
-        exit(1);   
-    }
-
-    Node* curr_node = stack->head;
-    Node* next;
-    while (curr_node) {
-        next = curr_node->next;
-        free(curr_node);
-        curr_node = next;
-    }
+    poolRelease(&stack->pool);
     stack->head = NULL;
-    stack->tail = 0;
+    stack->tail = NULL;
+    stack->size = 0;
 }
@@ -0,0 +1,765 @@
+/*
+
+-> Unrolled Linked List collection (Base: singly linked list of small arrays) <-
+
+This software is free and can be used and modifyied by anyone
+under the terms of the GNU General Public License as
+published by the Free Software Foundation, either version 3
+of the License, or any later version.
+
+[Author] -> Stacey Kerr
+[Github] -> https://github.com/wiseStann
+
+
+-> Structure <-
+
+typedef struct UNode_type {
+    struct UNode_type* next;
+    size_t count;
+    void* items[ULIST_NODE_ITEMS];
+} UNode;
+
+typedef struct ULL_type {
+    size_t size;
+    UNode* head;
+    UNode* tail;
+    NodePool pool;
+} UList;
+
+ Every node keeps up to [ULIST_NODE_ITEMS] neighbour elements of the list
+ in a small array and takes two cache lines. The pool of the list aligns
+ every node to a cache line, so a node never spans a third one. So a scan
+ misses the cache once per node, not once per element, and a link is paid
+ for a whole node, not for every element.
+
+ Inserting into a full node splits it in two halves, and a node, which
+ falls below half after a removal, takes elements from the next one or
+ merges with it. So the nodes in the middle stay at least half full and
+ moving elements inside a node costs O(ULIST_NODE_ITEMS). Appending to a
+ full last node and prepending to a full first one start a new node
+ instead of splitting, so lists built from one end are packed densely.
+
+
+-> Macroses <-
+
+Check Error macroses in "include/basic.h" header file.
+
+A short description of all:
+ -> [_EMPTY_LIST_ERROR], a macros for notification about empty given list
+ -> [_MEMORY_ALLOCATION_ERROR], a macros for notification about memory allocation error
+ -> [_INDEX_ERROR], a macros for notification about wrong given index
+
+*/
+
+#include "../include/ulist.h"
+
+
+/*
+
+New list creation.
+> Complex time - const.
+
+ Parameters [in]:
+    -> NULL
+
+ Parameters [out]:
+    -> [list], a new created list
+
+*/
+UList* ulistNew()
+{
+    UList* list = (UList*)malloc(sizeof(UList));
+    if (!list) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+
+    list->size = 0;
+    list->head = NULL;
+    list->tail = NULL;
+    // Nodes start at a cache line, so a node of two lines never touches the third one
+    poolInitAligned(&list->pool, sizeof(UNode), CACHE_LINE_SIZE);
+    return list;
+}
+
+/*
+
+New empty node creation from the pool of a given list.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [list], a list, which the node will belong to
+
+ Parameters [out]:
+    -> [node], a new created node
+
+*/
+static UNode* _ulistNodeNew__(UList* list)
+{
+    UNode* node = (UNode*)poolAlloc(&list->pool);
+    node->next = NULL;
+    node->count = 0;
+    return node;
+}
+
+/*
+
+Finding the node, which keeps the element standing at a given position.
+> Complex time - O(n / ULIST_NODE_ITEMS), const for the last node.
+
+ Parameters [in]:
+    -> [list], a list, which should be searched
+    -> [index], the position of element, less than the size of list,
+        the position of element inside of the found node is written here
+
+ Parameters [out]:
+    -> [node], the node of element
+
+*/
+static UNode* _ulistLocate__(UList* list, size_t* index)
+{
+    size_t tail_begin = list->size - list->tail->count;
+    if (*index >= tail_begin) {
+        *index -= tail_begin;
+        return list->tail;
+    }
+
+    UNode* node = list->head;
+    while (*index >= node->count) {
+        *index -= node->count;
+        node = node->next;
+    }
+    return node;
+}
+
+/*
+
+Moving the upper half of a full node to a new node standing after it.
+> Complex time - O(ULIST_NODE_ITEMS).
+
+ Parameters [in]:
+    -> [list], a list of the node
+    -> [node], a node, which should be split
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _ulistSplit__(UList* list, UNode* node)
+{
+    UNode* new_node = _ulistNodeNew__(list);
+    size_t half = node->count / 2;
+    new_node->count = node->count - half;
+    memcpy(new_node->items, node->items + half, new_node->count * sizeof(void*));
+    node->count = half;
+
+    new_node->next = node->next;
+    node->next = new_node;
+    if (list->tail == node) {
+        list->tail = new_node;
+    }
+}
+
+/*
+
+Filling a node, which fell below half, from the next one.
+> Complex time - O(ULIST_NODE_ITEMS).
+
+* If both nodes fit in one, the next node is merged into the given one,
+otherwise elements are moved, so that both nodes keep about the same number *
+
+ Parameters [in]:
+    -> [list], a list of the node
+    -> [node], a node, which has the next one
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _ulistRebalance__(UList* list, UNode* node)
+{
+    UNode* next = node->next;
+    if (node->count + next->count <= ULIST_NODE_ITEMS) {
+        memcpy(node->items + node->count, next->items, next->count * sizeof(void*));
+        node->count += next->count;
+        node->next = next->next;
+        if (list->tail == next) {
+            list->tail = node;
+        }
+        poolFree(&list->pool, next);
+        return;
+    }
+
+    size_t moved = (next->count - node->count) / 2;
+    memcpy(node->items + node->count, next->items, moved * sizeof(void*));
+    node->count += moved;
+    next->count -= moved;
+    memmove(next->items, next->items + moved, next->count * sizeof(void*));
+}
+
+/*
+
+Unlinking an empty node, which has no next node.
+> Complex time - O(n / ULIST_NODE_ITEMS), the node before it is searched from the head.
+
+ Parameters [in]:
+    -> [list], a list of the node
+    -> [node], an empty node, which should be removed
+
+ Parameters [out]:
+    -> NULL
+*/
+static void _ulistUnlinkEmpty__(UList* list, UNode* node)
+{
+    if (list->head == node) {
+        list->head = node->next;
+        if (!list->head) {
+            list->tail = NULL;
+        }
+    } else {
+        UNode* prev = list->head;
+        while (prev->next != node) {
+            prev = prev->next;
+        }
+        prev->next = node->next;
+        if (list->tail == node) {
+            list->tail = prev;
+        }
+    }
+    poolFree(&list->pool, node);
+}
+
+/*
+
+Creating a list from a given array.
+> Complex time - O(n).
+
+ Parameters [in]:
+    -> [array], an array, which is the base for a new list
+    -> [size], the number of elements of array
+
+ Parameters [out]:
+    -> [list], a new created list
+
+*/
+UList* ulistFromArr(void** array, size_t size)
+{
+    UList* list = ulistNew();
+    for (size_t i = 0; i < size; i++) {
+        ulistPush(list, array[i]);
+    }
+    return list;
+}
+
+/*
+
+Appending a given element to the end of the list.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [list], a list, to the end of which the element should be appended
+    -> [value], an element, which should be added to the list
+
+ Parameters [out]:
+    -> NULL
+*/
+void ulistPush(UList* list, void* value)
+{
+    if (!list->tail || list->tail->count == ULIST_NODE_ITEMS) {
+        UNode* new_node = _ulistNodeNew__(list);
+        if (!list->head) {
+            list->head = new_node;
+        } else {
+            list->tail->next = new_node;
+        }
+        list->tail = new_node;
+    }
+
+    list->tail->items[list->tail->count++] = value;
+    list->size++;
+}
+
+/*
+
+Prepending a given element to the beginning of the list.
+> Complex time - O(ULIST_NODE_ITEMS).
+
+ Parameters [in]:
+    -> [list], a list, to the beginning of which the element should be prepended
+    -> [value], an element, which should be prepended
+
+ Parameters [out]:
+    -> NULL
+*/
+void ulistPrepend(UList* list, void* value)
+{
+    if (!list->head || list->head->count == ULIST_NODE_ITEMS) {
+        UNode* new_node = _ulistNodeNew__(list);
+        new_node->next = list->head;
+        list->head = new_node;
+        if (!list->tail) {
+            list->tail = new_node;
+        }
+    }
+
+    UNode* head = list->head;
+    memmove(head->items + 1, head->items, head->count * sizeof(void*));
+    head->items[0] = value;
+    head->count++;
+    list->size++;
+}
+
+/*
+
+Inserting a given element at the specific position.
+> Complex time - O(n / ULIST_NODE_ITEMS + ULIST_NODE_ITEMS).
+
+ Parameters [in]:
+    -> [list], a list, where the element should be inserted
+    -> [value], an element, which should be inserted
+    -> [index], a position, where the element should stand after insertion
+
+ Parameters [out]:
+    -> NULL
+*/
+void ulistInsert(UList* list, void* value, size_t index)
+{
+    if (index == 0) {
+        ulistPrepend(list, value);
+        return;
+    } else if (!list->head) {
+        _EMPTY_LIST_ERROR;
+        return;
+    } else if (index > list->size) {
+        _INDEX_ERROR(index);
+        return;
+    } else if (index == list->size) {
+        ulistPush(list, value);
+        return;
+    }
+
+    size_t offset = index;
+    UNode* node = _ulistLocate__(list, &offset);
+    if (node->count == ULIST_NODE_ITEMS) {
+        _ulistSplit__(list, node);
+        if (offset > node->count) {
+            offset -= node->count;
+            node = node->next;
+        }
+    }
+
+    memmove(node->items + offset + 1, node->items + offset, (node->count - offset) * sizeof(void*));
+    node->items[offset] = value;
+    node->count++;
+    list->size++;
+}
+
+/*
+
+Removing an element standing at the specific position.
+> Complex time - O(n / ULIST_NODE_ITEMS + ULIST_NODE_ITEMS).
+
+ Parameters [in]:
+    -> [list], a list, from which the element should be removed
+    -> [index], the position of element
+
+ Parameters [out]:
+    -> NULL
+*/
+void ulistRemoveAt(UList* list, size_t index)
+{
+    if (!list->head) {
+        _EMPTY_LIST_ERROR;
+        return;
+    } else if (index >= list->size) {
+        _INDEX_ERROR(index);
+        return;
+    }
+
+    size_t offset = index;
+    UNode* node = _ulistLocate__(list, &offset);
+    node->count--;
+    memmove(node->items + offset, node->items + offset + 1, (node->count - offset) * sizeof(void*));
+    list->size--;
+
+    if (node->count < ULIST_MIN_ITEMS && node->next) {
+        _ulistRebalance__(list, node);
+    } else if (!node->count) {
+        _ulistUnlinkEmpty__(list, node);
+    }
+}
+
+/*
+
+Removing the last element of a given list.
+> Complex time - const, O(n / ULIST_NODE_ITEMS) if the last node gets empty.
+
+ Parameters [in]:
+    -> [list], a list, the last element of which should be removed
+
+ Parameters [out]:
+    -> NULL
+*/
+void ulistRemoveEnd(UList* list)
+{
+    if (!list->head) {
+        _EMPTY_LIST_ERROR;
+        return;
+    }
+    ulistRemoveAt(list, list->size - 1);
+}
+
+/*
+
+Removing the first element of a given list.
+> Complex time - O(ULIST_NODE_ITEMS).
+
+ Parameters [in]:
+    -> [list], a list, the first element of which should be removed
+
+ Parameters [out]:
+    -> NULL
+*/
+void ulistRemoveBegin(UList* list)
+{
+    if (!list->head) {
+        _EMPTY_LIST_ERROR;
+        return;
+    }
+    ulistRemoveAt(list, 0);
+}
+
+/*
+
+Getting the index of the first element with a given value.
+> Complex time - O(n).
+
+ Parameters [in]:
+    -> [list], a list, which should be searched
+    -> [value], a value, which should be found
+
+ Parameters [out]:
+    -> [index], the position of element, or -1 if there is no such element
+
+*/
+size_t ulistGetIndex(UList* list, void* value)
+{
+    size_t index = 0;
+    for (UNode* node = list->head; node; node = node->next) {
+        for (size_t i = 0; i < node->count; i++) {
+            if (node->items[i] == value) {
+                return index + i;
+            }
+        }
+        index += node->count;
+    }
+    return -1;
+}
+
+/*
+
+Getting an element standing at the specific position.
+> Complex time - O(n / ULIST_NODE_ITEMS), const for the last node.
+
+ Parameters [in]:
+    -> [list], a list, an element of which should be returned
+    -> [index], the position of element
+
+ Parameters [out]:
+    -> [value], the element, or NULL if the index is wrong
+
+*/
+void* ulistGetAt(UList* list, size_t index)
+{
+    if (!list->head) {
+        _EMPTY_LIST_ERROR;
+        return NULL;
+    } else if (index >= list->size) {
+        _INDEX_ERROR(index);
+        return NULL;
+    }
+
+    UNode* node = _ulistLocate__(list, &index);
+    return node->items[index];
+}
+
+/*
+
+Getting the first element of a given list.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [list], a list, the first element of which should be returned
+
+ Parameters [out]:
+    -> [value], the first element
+
+*/
+void* ulistGetBegin(UList* list)
+{
+    if (!list->head) {
+        _EMPTY_LIST_ERROR;
+        return NULL;
+    }
+    return list->head->items[0];
+}
+
+/*
+
+Getting the last element of a given list.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [list], a list, the last element of which should be returned
+
+ Parameters [out]:
+    -> [value], the last element
+
+*/
+void* ulistGetEnd(UList* list)
+{
+    if (!list->head) {
+        _EMPTY_LIST_ERROR;
+        return NULL;
+    }
+    return list->tail->items[list->tail->count - 1];
+}
+
+/*
+
+Removing the last element of a given list and returning it.
+> Complex time - const, O(n / ULIST_NODE_ITEMS) if the last node gets empty.
+
+ Parameters [in]:
+    -> [list], a list, the last element of which should be removed
+
+ Parameters [out]:
+    -> [end], the removed element
+
+*/
+void* ulistPop(UList* list)
+{
+    if (!list->head) {
+        _EMPTY_LIST_ERROR;
+        return NULL;
+    }
+
+    void* end = ulistGetEnd(list);
+    ulistRemoveEnd(list);
+    return end;
+}
+
+/*
+
+Removing the first element of a given list and returning it.
+> Complex time - O(ULIST_NODE_ITEMS).
+
+ Parameters [in]:
+    -> [list], a list, the first element of which should be removed
+
+ Parameters [out]:
+    -> [begin], the removed element
+
+*/
+void* ulistPoll(UList* list)
+{
+    if (!list->head) {
+        _EMPTY_LIST_ERROR;
+        return NULL;
+    }
+
+    void* begin = ulistGetBegin(list);
+    ulistRemoveBegin(list);
+    return begin;
+}
+
+/*
+
+Counting the elements with a given value.
+> Complex time - O(n).
+
+ Parameters [in]:
+    -> [list], a list, which should be searched
+    -> [value], a value, which should be counted
+
+ Parameters [out]:
+    -> [count], the number of elements with the value
+
+*/
+size_t ulistCount(UList* list, void* value)
+{
+    size_t count = 0;
+    for (UNode* node = list->head; node; node = node->next) {
+        for (size_t i = 0; i < node->count; i++) {
+            count += node->items[i] == value;
+        }
+    }
+    return count;
+}
+
+/*
+
+Checking if a given list contains a value or not.
+> Complex time - O(n).
+
+ Parameters [in]:
+    -> [list], a list, which should be checked
+    -> [value], a value, which should be searched
+
+ Parameters [out]:
+    -> [bool], the result of searching
+
+*/
+bool ulistContains(UList* list, void* value)
+{
+    return ulistGetIndex(list, value) != (size_t)-1;
+}
+
+/*
+
+Replacing an element standing at the specific position.
+> Complex time - O(n / ULIST_NODE_ITEMS), const for the last node.
+
+ Parameters [in]:
+    -> [list], a list, an element of which should be replaced
+    -> [index], the position of element
+    -> [value], a new value of element
+
+ Parameters [out]:
+    -> NULL
+*/
+void ulistReplaceByIndex(UList* list, size_t index, void* value)
+{
+    if (!list->head) {
+        _EMPTY_LIST_ERROR;
+        return;
+    } else if (index >= list->size) {
+        _INDEX_ERROR(index);
+        return;
+    }
+
+    UNode* node = _ulistLocate__(list, &index);
+    node->items[index] = value;
+}
+
+/*
+
+Removing all elements of a given list, the list may be used again.
+> Complex time - O(slabs), all nodes are freed together with the slabs of the pool.
+
+ Parameters [in]:
+    -> [list], a list, which should be cleared
+
+ Parameters [out]:
+    -> NULL
+*/
+void ulistClear(UList* list)
+{
+    poolRelease(&list->pool);
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+}
+
+/*
+
+Clearing all memory that was allocated for the list.
+> Complex time - O(slabs).
+
+ Parameters [in]:
+    -> [list], a list, which should be deleted
+
+ Parameters [out]:
+    -> NULL
+*/
+void ulistDelete(UList* list)
+{
+    poolRelease(&list->pool);
+    free(list);
+}
+
+/*
+
+Creating an iterator for a given list.
+> Complex time - const.
+
+* The iterator is valid until the list is changed *
+
+ Parameters [in]:
+    -> [list], a list, which should be wrapped in
+
+ Parameters [out]:
+    -> [iterator], a new created iterator, standing at the first element
+
+*/
+UListIterator* ulistIterNew(UList* list)
+{
+    UListIterator* iterator = (UListIterator*)malloc(sizeof(UListIterator));
+    if (!iterator) {
+        _MEMORY_ALLOCATION_ERROR;
+        exit(1);
+    }
+
+    iterator->list = list;
+    iterator->node = list->head;
+    iterator->curr_index = 0;
+    return iterator;
+}
+
+/*
+
+Checking if a given iterator has the next element.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [iterator], an iterator, which should be checked
+
+ Parameters [out]:
+    -> [bool], true if there is the next element
+
+*/
+bool ulistIterHasNext(UListIterator* iterator)
+{
+    return iterator->node != NULL;
+}
+
+/*
+
+Getting the next element of a wrapped in list.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [iterator], an iterator, which should be moved
+
+ Parameters [out]:
+    -> [value], the next element, or NULL if there is no one
+
+*/
+void* ulistIterNext(UListIterator* iterator)
+{
+    if (!ulistIterHasNext(iterator)) {
+        return NULL;
+    }
+
+    UNode* node = iterator->node;
+    void* value = node->items[iterator->curr_index++];
+    if (iterator->curr_index == node->count) {
+        iterator->node = node->next;
+        iterator->curr_index = 0;
+    }
+    return value;
+}
+
+/*
+
+Deleting a given iterator, the list stays untouched.
+> Complex time - const.
+
+ Parameters [in]:
+    -> [iterator], an iterator, which should be deleted
+
+ Parameters [out]:
+    -> NULL
+*/
+void ulistIterDelete(UListIterator* iterator)
+{
+    free(iterator);
+}